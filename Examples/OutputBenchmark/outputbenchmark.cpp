@@ -0,0 +1,121 @@
+/**
+ *  outputbenchmark.cpp
+ *
+ *  An example file that compares the speed of the different ways to send
+ *  output to PHP: the Php::out stream, the Php::output writer, and
+ *  publishing a prebuilt buffer without copying it
+ */
+
+/**
+ *  Libraries used.
+ */
+#include <iostream>
+#include <memory>
+#include <string>
+#include <phpcpp.h>
+
+/**
+ *  A prebuilt response, like a cached page
+ *  @param  size        Size of the response
+ *  @return std::shared_ptr
+ */
+static std::shared_ptr<const std::string> response(size_t size)
+{
+    // the response is only built when the size changes
+    static std::shared_ptr<const std::string> cached;
+
+    // build the response if it is not there yet
+    if (!cached || cached->size() != size) cached = std::make_shared<const std::string>(size, 'x');
+
+    // done
+    return cached;
+}
+
+/**
+ *  bench_out()
+ *
+ *  Writes a number of rows with the Php::out stream
+ *  @param  params      number of rows
+ */
+void bench_out(Php::Parameters &params)
+{
+    // number of rows to write
+    int64_t rows = params[0];
+
+    // write the rows
+    for (int64_t i = 0; i < rows; ++i) Php::out << "<tr><td>" << i << "</td><td>" << (i * 0.5) << "</td></tr>\n";
+
+    // flush the stream
+    Php::out << std::flush;
+}
+
+/**
+ *  bench_writer()
+ *
+ *  Writes a number of rows with the Php::output writer
+ *  @param  params      number of rows
+ */
+void bench_writer(Php::Parameters &params)
+{
+    // number of rows to write
+    int64_t rows = params[0];
+
+    // write the rows
+    for (int64_t i = 0; i < rows; ++i) Php::output << "<tr><td>" << i << "</td><td>" << (i * 0.5) << "</td></tr>\n";
+
+    // flush the writer
+    Php::output.flush();
+}
+
+/**
+ *  bench_copy()
+ *
+ *  Writes a prebuilt response a number of times with the Php::out stream
+ *  @param  params      number of times, and size of the response
+ */
+void bench_copy(Php::Parameters &params)
+{
+    // the response to write
+    auto buffer = response(params[1].numericValue());
+
+    // write it a number of times
+    for (int64_t i = 0, count = params[0]; i < count; ++i) Php::out.write(buffer->data(), buffer->size());
+
+    // flush the stream
+    Php::out << std::flush;
+}
+
+/**
+ *  bench_publish()
+ *
+ *  Publishes a prebuilt response a number of times
+ *  @param  params      number of times, and size of the response
+ */
+void bench_publish(Php::Parameters &params)
+{
+    // the response to write
+    auto buffer = response(params[1].numericValue());
+
+    // publish it a number of times
+    for (int64_t i = 0, count = params[0]; i < count; ++i) Php::output.publish(buffer);
+}
+
+// Symbols are exported according to the "C" language
+extern "C"
+{
+    // export the "get_module" function that will be called by the Zend engine
+    PHPCPP_EXPORT void *get_module()
+    {
+        // create extension
+        static Php::Extension extension("outputbenchmark","1.0");
+
+        // add the functions to the extension
+        extension.add<bench_out>("bench_out");
+        extension.add<bench_writer>("bench_writer");
+        extension.add<bench_copy>("bench_copy");
+        extension.add<bench_publish>("bench_publish");
+
+        // return the extension module
+        return extension.module();
+    }
+}
@@ -0,0 +1,36 @@
+<?php
+/*
+ *  outputbenchmark.php
+ *
+ *  Compares the throughput of the different ways to send output from C++.
+ *  The output itself should be sent to /dev/null, the results are written
+ *  to stderr:
+ *
+ *      php outputbenchmark.php > /dev/null
+ */
+
+// measure a function, and report the number of megabytes per second
+function measure($name, $function)
+{
+    // capture the output in a buffer, to count the bytes
+    ob_start();
+    $function();
+    $bytes = ob_get_length();
+    ob_end_clean();
+
+    // run it again without output buffering (the output goes to /dev/null)
+    $start = microtime(true);
+    $function();
+    $time = microtime(true) - $start;
+
+    // report the result
+    fprintf(STDERR, "%-30s %10.1f MB/s\n", $name, $bytes / $time / 1048576);
+}
+
+// generated rows
+measure("Php::out rows", function() { bench_out(1000000); });
+measure("Php::output rows", function() { bench_writer(1000000); });
+
+// prebuilt responses of 1MB
+measure("Php::out prebuilt", function() { bench_copy(100, 1 << 20); });
+measure("Php::output.publish prebuilt", function() { bench_publish(100, 1 << 20); });
@@ -38,6 +38,12 @@ const int Private   =   0x04;
 const int Const     =   0;
 #endif
 
+/**
+ *  The mutating flag is never passed to the Zend engine, so it uses a bit
+ *  that is not in use by any of the other modifiers
+ */
+const int Mutating  =   0x10000000;
+
 /**
  *  Modifiers that are supported for methods and properties
  */
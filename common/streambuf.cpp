@@ -49,8 +49,8 @@ int StreamBuf::overflow(int c)
     // increment buffer size
     pbump(1);
     
-    // and now we're going to syn the buffer
-    return sync() == -1 ? EOF : c;
+    // and now we're going to empty the buffer
+    return drain() == -1 ? EOF : c;
 }
 
 /**
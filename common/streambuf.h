@@ -68,6 +68,13 @@ protected:
     virtual int sync() override;
 
 private:
+    /**
+     *  Move the buffered data out of the way, without flushing it (for the
+     *  regular output, it is moved to the Php::output writer)
+     *  @return int
+     */
+    int drain();
+
     /**
      *  The error type, or 0 for regular output
      *  @var    int
@@ -293,6 +293,29 @@ public:
      */
     Php::Value __getIterator();
 
+    /**
+     *  Export the properties of the object
+     *
+     *  This method is called when the object is casted to an array, or when
+     *  it is passed to json_encode(), var_export() or similar functions. You
+     *  can override this method to add the fields of the object to the array
+     *  in one go, instead of having them fetched one by one via __get().
+     *  The array has already been sized for the properties that were
+     *  registered for the class. This requires PHP 7.4 or higher.
+     *
+     *  @param  properties  Array to which the properties are added
+     */
+    void __properties(Php::Array &properties) const;
+
+    /**
+     *  Export the properties of the object for debugging
+     *
+     *  This method is called by var_dump() and similar functions. You can
+     *  override this method to show the fields of the object.
+     *
+     *  @param  properties  Array to which the properties are added
+     */
+    void __debugInfo(Php::Array &properties) const;
 
 private:
     /**
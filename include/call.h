@@ -18,6 +18,7 @@ namespace Php {
 extern PHPCPP_EXPORT    bool  class_exists(const char *classname, size_t size, bool autoload = true);
 static inline           bool  class_exists(const char *classname, bool autoload = true) { return class_exists(classname, strlen(classname), autoload); }
 static inline           bool  class_exists(const std::string &classname, bool autoload = true) { return class_exists(classname.c_str(), classname.size(), autoload); }
+extern PHPCPP_EXPORT    bool  class_exists(const ClassRef &classref, bool autoload = true);
 extern PHPCPP_EXPORT    Value constant(const char *constant);
 extern PHPCPP_EXPORT    Value constant(const char *constant, size_t size);
 extern PHPCPP_EXPORT    Value constant(const std::string &constant);
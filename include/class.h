@@ -88,6 +88,14 @@ public:
     template <Value (T::*callback)()                    const   >   Class<T> &method(const char *name,              const Arguments &args = {})  { ClassBase::method(name, &ZendCallable::invoke<T, callback>, Public, args); return *this; }
     template <void  (T::*callback)(Parameters &params)  const   >   Class<T> &method(const char *name,              const Arguments &args = {})  { ClassBase::method(name, &ZendCallable::invoke<T, callback>, Public, args); return *this; }
     template <Value (T::*callback)(Parameters &params)  const   >   Class<T> &method(const char *name,              const Arguments &args = {})  { ClassBase::method(name, &ZendCallable::invoke<T, callback>, Public, args); return *this; }
+    template <Result<Value> (T::*callback)()                    >   Class<T> &method(const char *name,  int flags,  const Arguments &args = {})  { ClassBase::method(name, &ZendCallable::invoke<T, callback>, flags,  args); return *this; }
+    template <Result<Value> (T::*callback)(Parameters &params)          >   Class<T> &method(const char *name,  int flags,  const Arguments &args = {})  { ClassBase::method(name, &ZendCallable::invoke<T, callback>, flags,  args); return *this; }
+    template <Result<Value> (T::*callback)()                    const   >   Class<T> &method(const char *name,  int flags,  const Arguments &args = {})  { ClassBase::method(name, &ZendCallable::invoke<T, callback>, flags,  args); return *this; }
+    template <Result<Value> (T::*callback)(Parameters &params)  const   >   Class<T> &method(const char *name,  int flags,  const Arguments &args = {})  { ClassBase::method(name, &ZendCallable::invoke<T, callback>, flags,  args); return *this; }
+    template <Result<Value> (T::*callback)()                    >   Class<T> &method(const char *name,              const Arguments &args = {})  { ClassBase::method(name, &ZendCallable::invoke<T, callback>, Public, args); return *this; }
+    template <Result<Value> (T::*callback)(Parameters &params)          >   Class<T> &method(const char *name,              const Arguments &args = {})  { ClassBase::method(name, &ZendCallable::invoke<T, callback>, Public, args); return *this; }
+    template <Result<Value> (T::*callback)()                    const   >   Class<T> &method(const char *name,              const Arguments &args = {})  { ClassBase::method(name, &ZendCallable::invoke<T, callback>, Public, args); return *this; }
+    template <Result<Value> (T::*callback)(Parameters &params)  const   >   Class<T> &method(const char *name,              const Arguments &args = {})  { ClassBase::method(name, &ZendCallable::invoke<T, callback>, Public, args); return *this; }
 
     /**
      *  Add a static method to a class
@@ -117,6 +125,10 @@ public:
     template <Value (*callback)()                               >   Class<T> &method(const char *name,              const Arguments &args = {}) { ClassBase::method(name, &ZendCallable::invoke<callback>, Static | Public, args); return *this; }
     template <void  (*callback)(Parameters &parameters)         >   Class<T> &method(const char *name,              const Arguments &args = {}) { ClassBase::method(name, &ZendCallable::invoke<callback>, Static | Public, args); return *this; }
     template <Value (*callback)(Parameters &parameters)         >   Class<T> &method(const char *name,              const Arguments &args = {}) { ClassBase::method(name, &ZendCallable::invoke<callback>, Static | Public, args); return *this; }
+    template <Result<Value> (*callback)()                       >   Class<T> &method(const char *name, int flags,   const Arguments &args = {}) { ClassBase::method(name, &ZendCallable::invoke<callback>, Static | flags,  args); return *this; }
+    template <Result<Value> (*callback)(Parameters &parameters) >   Class<T> &method(const char *name, int flags,   const Arguments &args = {}) { ClassBase::method(name, &ZendCallable::invoke<callback>, Static | flags,  args); return *this; }
+    template <Result<Value> (*callback)()                       >   Class<T> &method(const char *name,              const Arguments &args = {}) { ClassBase::method(name, &ZendCallable::invoke<callback>, Static | Public, args); return *this; }
+    template <Result<Value> (*callback)(Parameters &parameters) >   Class<T> &method(const char *name,              const Arguments &args = {}) { ClassBase::method(name, &ZendCallable::invoke<callback>, Static | Public, args); return *this; }
 
     /**
      *  Add a regular method to the class
@@ -303,6 +315,30 @@ public:
     template<typename CLASS>
     Class<T> &extends(const Class<CLASS> &base) { ClassBase::extends(base); return *this; }
 
+    /**
+     *  Let clones share the C++ object until one of them is modified
+     *
+     *  By default, cloning an object in PHP space creates a copy of the C++
+     *  object right away. For classes with large payloads that are seldom
+     *  modified (like lookup tables) this is wasteful. With copy-on-write,
+     *  the clone shares the C++ object with the original, and a copy is
+     *  only made when a method that was registered with the Php::Mutating
+     *  flag is called, when a property or array offset is assigned or
+     *  unset, or when the object is called via __call() or __invoke().
+     *  The magic __clone() method is called when the copy is made.
+     *
+     *      Php::Class<Table> table("Table");
+     *      table.copyOnWrite();
+     *      table.method<&Table::lookup>("lookup");
+     *      table.method<&Table::insert>("insert", Php::Public | Php::Mutating);
+     *
+     *  Methods without the Php::Mutating flag run on the shared object, so
+     *  they should not modify it. The class must be copy constructable.
+     *
+     *  @return Class       Same object to allow chaining
+     */
+    Class<T> &copyOnWrite() { ClassBase::copyOnWrite(); return *this; }
+
 private:
     /**
      *  Method to create the object if it is default constructable
@@ -416,6 +452,26 @@ private:
         return std::is_base_of<Countable,T>::value;
     }
 
+    /**
+     *  Does the class override the __properties() method?
+     *  @return bool
+     */
+    virtual bool exportable() const override
+    {
+        // if the method is not overridden, its address is still a member of Base
+        return !std::is_same<decltype(&T::__properties), void (Base::*)(Array &) const>::value;
+    }
+
+    /**
+     *  Does the class override the __debugInfo() method?
+     *  @return bool
+     */
+    virtual bool debuggable() const override
+    {
+        // if the method is not overridden, its address is still a member of Base
+        return !std::is_same<decltype(&T::__debugInfo), void (Base::*)(Array &) const>::value;
+    }
+
     /**
      *  Call the __clone method
      *  @param  base
@@ -667,6 +723,34 @@ private:
         return obj->__isset(name);
     }
 
+    /**
+     *  Export the properties of an object
+     *  @param  base
+     *  @param  properties
+     */
+    virtual void callProperties(Base *base, Array &properties) const override
+    {
+        // cast to actual object
+        T *obj = (T *)base;
+
+        // pass on
+        obj->__properties(properties);
+    }
+
+    /**
+     *  Export the properties of an object for debugging
+     *  @param  base
+     *  @param  properties
+     */
+    virtual void callDebugInfo(Base *base, Array &properties) const override
+    {
+        // cast to actual object
+        T *obj = (T *)base;
+
+        // pass on
+        obj->__debugInfo(properties);
+    }
+
     /**
      *  Compare two objects
      *  @param  object1
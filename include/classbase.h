@@ -127,6 +127,14 @@ public:
     virtual bool countable()    const { return false; }
     virtual bool clonable()     const { return false; }
 
+    /**
+     *  Methods to check if the __properties() or __debugInfo() methods
+     *  are overridden
+     *  @return bool
+     */
+    virtual bool exportable()   const { return false; }
+    virtual bool debuggable()   const { return false; }
+
     /**
      *  Compare two objects
      *  @param  object1
@@ -175,6 +183,14 @@ public:
     virtual void  callUnset(Base *base, const Value &name) const {}
     virtual bool  callIsset(Base *base, const Value &name) const { return false; }
 
+    /**
+     *  Functions to export the properties of an object
+     *  @param  base
+     *  @param  properties
+     */
+    virtual void callProperties(Base *base, Array &properties) const {}
+    virtual void callDebugInfo(Base *base, Array &properties) const {}
+
     /**
      *  Get access to the implementation object
      *  @return std::shared_ptr
@@ -304,6 +320,11 @@ protected:
      */
     void extends(const ClassBase &base);
 
+    /**
+     *  Let clones share the C++ object until one of them is modified
+     */
+    void copyOnWrite();
+
 private:
     /**
      *  Pointer to the actual implementation
@@ -0,0 +1,106 @@
+/**
+ *  ClassRef.h
+ *
+ *  Handle to a PHP class that is looked up only once per request. The class
+ *  entry is resolved the first time that it is needed in a request (which
+ *  may trigger the autoloader), and later uses in the same request skip the
+ *  lookup by name. ClassRef objects are normally created as static variables:
+ *
+ *      static Php::ClassRef order("Shop\\Order");
+ *
+ *      Php::Object object(order, id);
+ *      if (value.instanceOf(order)) { ... }
+ *      if (Php::class_exists(order)) { ... }
+ *
+ *  Classes that do not (yet) exist are looked up again every time. On thread
+ *  safe PHP builds, the class is looked up every time too, because static
+ *  handles are shared between the threads, but the lowercase name is still
+ *  prepared only once.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class PHPCPP_EXPORT ClassRef
+{
+public:
+    /**
+     *  Constructor
+     *  @param  name        Name of the class
+     *  @param  size        Size of the name
+     */
+    ClassRef(const char *name, size_t size);
+
+    /**
+     *  Constructor
+     *  @param  name        Name of the class
+     */
+    explicit ClassRef(const char *name) : ClassRef(name, strlen(name)) {}
+
+    /**
+     *  Constructor
+     *  @param  name        Name of the class
+     */
+    explicit ClassRef(const std::string &name) : ClassRef(name.c_str(), name.size()) {}
+
+    /**
+     *  Handles can not be copied
+     *  @param  that
+     */
+    ClassRef(const ClassRef &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~ClassRef();
+
+    /**
+     *  Name of the class
+     *  @return std::string
+     */
+    const std::string &name() const { return _name; }
+
+    /**
+     *  The class entry (nullptr if the class does not exist)
+     *  @param  autoload    Should the autoloader be called for unknown classes?
+     *  @return struct _zend_class_entry
+     */
+    struct _zend_class_entry *entry(bool autoload = true) const;
+
+private:
+    /**
+     *  Name of the class (without a leading backslash)
+     *  @var    std::string
+     */
+    std::string _name;
+
+    /**
+     *  The name in lowercase, which is the key in the class table
+     *  @var    struct _zend_string
+     */
+    struct _zend_string *_key;
+
+    /**
+     *  The class entry, when it was already looked up
+     *  @var    struct _zend_class_entry
+     */
+    mutable struct _zend_class_entry *_entry = nullptr;
+
+    /**
+     *  The request in which the class entry was looked up
+     *  @var    uint64_t
+     */
+    mutable uint64_t _request = 0;
+};
+
+/**
+ *  End namespace
+ */
+}
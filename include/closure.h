@@ -0,0 +1,267 @@
+/**
+ *  Closure.h
+ *
+ *  Move-only wrapper around a C++ function, lambda or other callable object,
+ *  that can be turned into a PHP callable with Php::Function. Unlike a
+ *  std::function, it stores the callable (and thus the captured variables
+ *  of a lambda) in the wrapper itself as long as it fits in a buffer of
+ *  PHPCPP_CLOSURE_SIZE bytes, so no memory has to be allocated for it.
+ *  Larger callables are moved to the heap.
+ *
+ *  The callable may accept a Php::Parameters reference or no parameters at
+ *  all, and may return anything that can be converted into a Php::Value, or
+ *  nothing at all.
+ *
+ *  The buffer size can be changed by defining PHPCPP_CLOSURE_SIZE, this has
+ *  to be the same value when compiling PHP-CPP and when compiling the
+ *  extension.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  The number of bytes that are available for callables without allocating memory
+ */
+#ifndef PHPCPP_CLOSURE_SIZE
+#define PHPCPP_CLOSURE_SIZE 64
+#endif
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class Closure
+{
+private:
+    /**
+     *  Helper functions to find out if an object can be called, with or without parameters
+     *  @return std::true_type|std::false_type
+     */
+    template <typename F> static auto callable(int) -> decltype(std::declval<F&>()(std::declval<Parameters&>()), std::true_type());
+    template <typename F> static auto callable(long) -> decltype(std::declval<F&>()(), std::true_type());
+    template <typename F> static std::false_type callable(...);
+
+public:
+    /**
+     *  Can an object of a certain type be stored in a closure? Php::Value
+     *  objects are excluded, because they can be called too (and they are
+     *  PHP callables already)
+     */
+    template <typename F, typename T = typename std::decay<F>::type>
+    struct accepts : std::integral_constant<bool, decltype(callable<T>(0))::value && !std::is_base_of<Value, T>::value && !std::is_same<Closure, T>::value> {};
+
+    /**
+     *  Constructor for an empty closure
+     */
+    Closure() = default;
+
+    /**
+     *  Constructor to wrap a callable object
+     *  @param  function    The function, lambda or other callable object
+     */
+    template <typename F, typename = typename std::enable_if<accepts<F>::value>::type>
+    Closure(F &&function)
+    {
+        // the type of object to store
+        using T = typename std::decay<F>::type;
+
+        // store it in the buffer if it fits, and can be moved without throwing
+        assign<T>(std::integral_constant<bool, sizeof(T) <= sizeof(_buffer) && alignof(T) <= alignof(Buffer) && std::is_nothrow_move_constructible<T>::value>(), std::forward<F>(function));
+    }
+
+    /**
+     *  Move constructor
+     *  @param  that
+     */
+    Closure(Closure &&that) noexcept : _operations(that._operations)
+    {
+        // move the callable over
+        if (_operations) _operations->move(&that._buffer, &_buffer);
+
+        // the other closure is now empty
+        that._operations = nullptr;
+    }
+
+    /**
+     *  Closures can not be copied
+     *  @param  that
+     */
+    Closure(const Closure &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    ~Closure()
+    {
+        // destruct the callable
+        if (_operations) _operations->destroy(&_buffer);
+    }
+
+    /**
+     *  Move assignment
+     *  @param  that
+     *  @return Closure
+     */
+    Closure &operator=(Closure &&that) noexcept
+    {
+        // check for self assignment
+        if (this == &that) return *this;
+
+        // destruct the current callable
+        if (_operations) _operations->destroy(&_buffer);
+
+        // move the callable over
+        _operations = that._operations;
+        if (_operations) _operations->move(&that._buffer, &_buffer);
+
+        // the other closure is now empty
+        that._operations = nullptr;
+
+        // allow chaining
+        return *this;
+    }
+
+    /**
+     *  Closures can not be copied
+     *  @param  that
+     *  @return Closure
+     */
+    Closure &operator=(const Closure &that) = delete;
+
+    /**
+     *  Is a callable stored in the closure?
+     *  @return bool
+     */
+    explicit operator bool () const
+    {
+        return _operations != nullptr;
+    }
+
+    /**
+     *  Call the callable
+     *  @param  params      The parameters to pass on
+     *  @return Value
+     */
+    Value operator()(Parameters &params) const
+    {
+        // an empty closure does nothing
+        if (!_operations) return nullptr;
+
+        // call the callable
+        return _operations->invoke(const_cast<Buffer*>(&_buffer), params);
+    }
+
+private:
+    /**
+     *  Buffer in which the callable (or a pointer to it) is stored
+     */
+    using Buffer = typename std::aligned_storage<PHPCPP_CLOSURE_SIZE>::type;
+
+    /**
+     *  Functions to call, move and destruct the stored callable
+     */
+    struct Operations
+    {
+        Value (*invoke)(void *buffer, Parameters &params);
+        void (*move)(void *from, void *to);
+        void (*destroy)(void *buffer);
+    };
+
+    /**
+     *  The operations for the type of callable that is stored
+     *  @var    Operations
+     */
+    const Operations *_operations = nullptr;
+
+    /**
+     *  The buffer that holds the callable (or a pointer to it)
+     *  @var    Buffer
+     */
+    Buffer _buffer;
+
+    /**
+     *  Helper functions to call a callable that returns a value or nothing
+     *  @param  function    The callable
+     *  @param  args        Parameters to pass on
+     *  @return Value
+     */
+    template <typename F, typename ...Args>
+    static Value result(std::false_type, F &function, Args&... args) { return function(args...); }
+    template <typename F, typename ...Args>
+    static Value result(std::true_type, F &function, Args&... args) { function(args...); return nullptr; }
+
+    /**
+     *  Helper functions to call a callable that accepts parameters or not
+     *  @param  function    The callable
+     *  @param  params      The parameters
+     *  @return Value
+     */
+    template <typename F>
+    static auto call(F &function, Parameters &params, int) -> decltype(function(params), Value())
+    {
+        return result(std::is_void<decltype(function(params))>(), function, params);
+    }
+    template <typename F>
+    static Value call(F &function, Parameters &params, long)
+    {
+        return result(std::is_void<decltype(function())>(), function);
+    }
+
+    /**
+     *  Operations for callables that are stored in the buffer
+     */
+    template <typename T>
+    struct Inline
+    {
+        static Value invoke(void *buffer, Parameters &params) { return call(*static_cast<T*>(buffer), params, 0); }
+        static void move(void *from, void *to) { new (to) T(std::move(*static_cast<T*>(from))); static_cast<T*>(from)->~T(); }
+        static void destroy(void *buffer) { static_cast<T*>(buffer)->~T(); }
+        static const Operations operations;
+    };
+
+    /**
+     *  Operations for callables that are stored on the heap
+     */
+    template <typename T>
+    struct Allocated
+    {
+        static Value invoke(void *buffer, Parameters &params) { return call(**static_cast<T**>(buffer), params, 0); }
+        static void move(void *from, void *to) { *static_cast<T**>(to) = *static_cast<T**>(from); }
+        static void destroy(void *buffer) { delete *static_cast<T**>(buffer); }
+        static const Operations operations;
+    };
+
+    /**
+     *  Store a callable in the buffer, or on the heap
+     *  @param  function    The callable
+     */
+    template <typename T, typename F>
+    void assign(std::true_type, F &&function)
+    {
+        new (&_buffer) T(std::forward<F>(function));
+        _operations = &Inline<T>::operations;
+    }
+    template <typename T, typename F>
+    void assign(std::false_type, F &&function)
+    {
+        *reinterpret_cast<T**>(&_buffer) = new T(std::forward<F>(function));
+        _operations = &Allocated<T>::operations;
+    }
+};
+
+/**
+ *  The operation tables
+ */
+template <typename T>
+const Closure::Operations Closure::Inline<T>::operations = { &Inline<T>::invoke, &Inline<T>::move, &Inline<T>::destroy };
+template <typename T>
+const Closure::Operations Closure::Allocated<T>::operations = { &Allocated<T>::invoke, &Allocated<T>::move, &Allocated<T>::destroy };
+
+/**
+ *  End namespace
+ */
+}
@@ -0,0 +1,164 @@
+/**
+ *  ConstantEntry.h
+ *
+ *  Entry in a static table of constants. Extensions that define many
+ *  constants (for example generated error codes or enumeration values) can
+ *  put them in a constexpr array, and add the whole array to the extension
+ *  or a namespace at once. The names and values are stored in the array
+ *  itself, so nothing has to be allocated until the constants are registered
+ *  in the Zend engine (and the table does not have to be copied either).
+ *
+ *      static constexpr Php::ConstantEntry errors[] = {
+ *          { "ERROR_NONE",     0 },
+ *          { "ERROR_TIMEOUT",  1 },
+ *          { "ERROR_MESSAGE",  "the operation timed out" },
+ *      };
+ *
+ *      extension.add(errors);
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class ConstantEntry
+{
+public:
+    /**
+     *  Constructor for a null constant
+     *  @param  name        Name of the constant
+     *  @param  value       Value of the constant
+     */
+    template <size_t N>
+    constexpr ConstantEntry(const char (&name)[N], std::nullptr_t value) : _name(name), _size(N - 1), _type(Type::Null), _numeric(0) {}
+
+    /**
+     *  Constructor for a boolean constant
+     *  @param  name        Name of the constant
+     *  @param  value       Value of the constant
+     */
+    template <size_t N>
+    constexpr ConstantEntry(const char (&name)[N], bool value) : _name(name), _size(N - 1), _type(value ? Type::True : Type::False), _numeric(0) {}
+
+    /**
+     *  Constructor for integer constants, for all integer types (like int,
+     *  long long, unsigned and size_t) the value is stored as an int64_t
+     *  @param  name        Name of the constant
+     *  @param  value       Value of the constant
+     */
+    template <size_t N, typename T, typename = typename std::enable_if<std::is_integral<T>::value && !std::is_same<T,bool>::value>::type>
+    constexpr ConstantEntry(const char (&name)[N], T value) : _name(name), _size(N - 1), _type(Type::Numeric), _numeric((int64_t)value) {}
+
+    /**
+     *  Constructor for a floating point constant
+     *  @param  name        Name of the constant
+     *  @param  value       Value of the constant
+     */
+    template <size_t N>
+    constexpr ConstantEntry(const char (&name)[N], double value) : _name(name), _size(N - 1), _type(Type::Float), _floating(value) {}
+
+    /**
+     *  Constructor for a string literal constant
+     *  @param  name        Name of the constant
+     *  @param  value       Value of the constant
+     */
+    template <size_t N, size_t M>
+    constexpr ConstantEntry(const char (&name)[N], const char (&value)[M]) : _name(name), _size(N - 1), _type(Type::String), _string(value), _length(M - 1) {}
+
+    /**
+     *  Constructor for a string constant with an explicit size
+     *  @param  name        Name of the constant
+     *  @param  value       Value of the constant
+     *  @param  size        Size of the value
+     */
+    template <size_t N>
+    constexpr ConstantEntry(const char (&name)[N], const char *value, size_t size) : _name(name), _size(N - 1), _type(Type::String), _string(value), _length(size) {}
+
+    /**
+     *  Constructors for entries with a name that is not a literal
+     *  @param  name        Name of the constant
+     *  @param  size        Size of the name
+     *  @param  value       Value of the constant
+     */
+    template <typename T, typename = typename std::enable_if<std::is_integral<T>::value && !std::is_same<T,bool>::value>::type>
+    constexpr ConstantEntry(const char *name, size_t size, T value) : _name(name), _size(size), _type(Type::Numeric), _numeric((int64_t)value) {}
+    constexpr ConstantEntry(const char *name, size_t size, double value) : _name(name), _size(size), _type(Type::Float), _floating(value) {}
+    constexpr ConstantEntry(const char *name, size_t size, const char *value, size_t length) : _name(name), _size(size), _type(Type::String), _string(value), _length(length) {}
+
+    /**
+     *  Name of the constant
+     *  @return const char *
+     */
+    constexpr const char *name() const { return _name; }
+
+    /**
+     *  Size of the name
+     *  @return size_t
+     */
+    constexpr size_t size() const { return _size; }
+
+    /**
+     *  Type of the constant
+     *  @return Type
+     */
+    constexpr Type type() const { return _type; }
+
+    /**
+     *  The value of an integer constant
+     *  @return int64_t
+     */
+    constexpr int64_t numeric() const { return _numeric; }
+
+    /**
+     *  The value of a floating point constant
+     *  @return double
+     */
+    constexpr double floating() const { return _floating; }
+
+    /**
+     *  The value of a string constant, and its size
+     *  @return const char *
+     */
+    constexpr const char *string() const { return _string; }
+    constexpr size_t length() const { return _length; }
+
+private:
+    /**
+     *  Name of the constant, and its size
+     *  @var    const char *
+     */
+    const char *_name;
+    size_t _size;
+
+    /**
+     *  Type of the constant
+     *  @var    Type
+     */
+    Type _type;
+
+    /**
+     *  The value
+     */
+    union {
+        int64_t _numeric;
+        double _floating;
+        const char *_string;
+    };
+
+    /**
+     *  Size of a string value
+     *  @var    size_t
+     */
+    size_t _length = 0;
+};
+
+/**
+ *  End namespace
+ */
+}
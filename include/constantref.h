@@ -0,0 +1,108 @@
+/**
+ *  ConstantRef.h
+ *
+ *  Handle to a PHP constant (or class constant, like "Foo::BAR") that is
+ *  looked up only once per request. The constant is resolved the first time
+ *  that it is read in a request, and later reads in the same request use the
+ *  remembered value, without looking up the name again. ConstantRef objects
+ *  are normally created as static variables:
+ *
+ *      static Php::ConstantRef level("MY_LOG_LEVEL");
+ *      if (level.value() > 2) { ... }
+ *
+ *  Constants that do not (yet) exist are looked up again every time. On
+ *  thread safe PHP builds, the constant is looked up every time too, because
+ *  static handles are shared between the threads.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class PHPCPP_EXPORT ConstantRef
+{
+public:
+    /**
+     *  Constructor
+     *  @param  name        Name of the constant
+     *  @param  size        Size of the name
+     */
+    ConstantRef(const char *name, size_t size) : _name(name, size) {}
+
+    /**
+     *  Constructor
+     *  @param  name        Name of the constant
+     */
+    ConstantRef(const char *name) : _name(name) {}
+
+    /**
+     *  Constructor
+     *  @param  name        Name of the constant
+     */
+    ConstantRef(const std::string &name) : _name(name) {}
+
+    /**
+     *  Destructor
+     */
+    virtual ~ConstantRef() = default;
+
+    /**
+     *  Name of the constant
+     *  @return std::string
+     */
+    const std::string &name() const { return _name; }
+
+    /**
+     *  Does the constant exist?
+     *  @return bool
+     */
+    bool defined() const { return lookup() != nullptr; }
+
+    /**
+     *  The value of the constant (null if it does not exist)
+     *  @return Value
+     */
+    Value value() const;
+
+    /**
+     *  Cast to a value
+     *  @return Value
+     */
+    operator Value () const { return value(); }
+
+private:
+    /**
+     *  Name of the constant
+     *  @var    std::string
+     */
+    std::string _name;
+
+    /**
+     *  The value of the constant, when it was already looked up
+     *  @var    struct _zval_struct
+     */
+    mutable struct _zval_struct *_value = nullptr;
+
+    /**
+     *  The request in which the value was looked up
+     *  @var    uint64_t
+     */
+    mutable uint64_t _request = 0;
+
+    /**
+     *  Find the value of the constant
+     *  @return struct _zval_struct
+     */
+    struct _zval_struct *lookup() const;
+};
+
+/**
+ *  End namespace
+ */
+}
@@ -149,6 +149,28 @@ public:
      */
     void iniVariables(const std::function<void(Ini &ini)> &callback);
 
+    /**
+     *  Register a struct as the module globals of the extension
+     *
+     *  The struct is default constructed when the module is registered (for
+     *  each thread on thread safe PHP builds), and destructed when the module
+     *  is unloaded. If reset is set, it is also constructed again after each
+     *  request. An extension has only one globals struct: when this method is
+     *  called again with the same type, the object that was registered first
+     *  is returned, and a Php::Error is thrown for a different type (or when
+     *  nothing was registered before the extension was locked). The returned
+     *  object lives as long as the extension.
+     *
+     *  @param  reset               Should the struct be constructed again after each request?
+     *  @return ModuleGlobals<T>    Object that gives access to the struct
+     */
+    template <typename T>
+    ModuleGlobals<T> &globals(bool reset = false)
+    {
+        // register a new object
+        return *static_cast<ModuleGlobals<T> *>(install(new ModuleGlobals<T>(reset)));
+    }
+
     /**
      *  Retrieve the module pointer
      *
@@ -180,6 +202,13 @@ protected:
     virtual bool locked() const override;
 
 private:
+    /**
+     *  Register the module globals
+     *  @param  globals     The globals to register (ownership is taken)
+     *  @return ModuleGlobalsBase
+     */
+    ModuleGlobalsBase *install(ModuleGlobalsBase *globals);
+
     /**
      *  The implementation object
      *
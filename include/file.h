@@ -12,6 +12,7 @@
  *  Forward declarations
  */
 struct _zend_string;
+struct _zend_array;
 
 /**
  *  Set up namespace
@@ -83,6 +84,36 @@ public:
      */
     Value execute();
 
+    /**
+     *  Execute the file in an isolated scope
+     *
+     *  The file only sees the variables in the scope, and not the ones of
+     *  the calling function. Variables that the file assigns are stored in
+     *  the scope.
+     *
+     *  @param  scope       The scope with the variables
+     *  @return Php::Value
+     */
+    Value execute(Scope &scope);
+
+    /**
+     *  Statistics of the file cache of the current thread
+     *
+     *  With the "phpcpp.file_cache" php.ini setting turned on, the resolved
+     *  absolute paths, the existence of files and the compiled files are
+     *  remembered during a request, so that including the same file again
+     *  is cheap. With the "phpcpp.file_cache_ttl" php.ini setting, resolved
+     *  absolute paths are also remembered across requests for the given
+     *  number of seconds.
+     *  This method returns an array with the number of hits and misses for
+     *  resolving ("resolve_hits", "resolve_misses"), for checking if files
+     *  exist ("stat_hits", "stat_misses") and for compiling ("compile_hits",
+     *  "compile_misses").
+     *
+     *  @return Value
+     */
+    static Value statistics();
+
 private:
     /**
      *  The original path
@@ -97,10 +128,10 @@ private:
     struct _zend_string *_path = nullptr;
 
     /**
-     *  The opcodes of this file
-     *  @var std::unique_ptr<Opcodes>
+     *  The opcodes of this file, these may be shared with the file cache
+     *  @var std::shared_ptr<Opcodes>
      */
-    std::unique_ptr<Opcodes> _opcodes;
+    std::shared_ptr<Opcodes> _opcodes;
 
     /**
      *  Compile the file
@@ -108,6 +139,13 @@ private:
      */
     bool compile();
 
+    /**
+     *  Execute the file
+     *  @param  symbols     Symbol table of an isolated scope, or nullptr
+     *  @return Php::Value
+     */
+    Value execute(struct _zend_array *symbols);
+
 };
 
 /**
@@ -34,6 +34,24 @@ namespace Php {
 class PHPCPP_EXPORT Function : public Value
 {
 public:
+    /**
+     *  Constructor to wrap a closure
+     *
+     *  The closure is moved into the PHP object, lambdas with small captures
+     *  are thus wrapped without allocating memory for the lambda itself.
+     *
+     *  @param  closure         The closure to be wrapped
+     */
+    Function(Closure &&closure);
+
+    /**
+     *  Constructor to wrap a lambda or other callable object, that accepts
+     *  a Php::Parameters reference or no parameters at all
+     *  @param  function        The C++ function to be wrapped
+     */
+    template <typename F, typename = typename std::enable_if<Closure::accepts<F>::value>::type>
+    Function(F &&function) : Function(Closure(std::forward<F>(function))) {}
+
     /**
      *  Constructor to wrap a function that takes parameters
      *  @param  function        The C++ function to be wrapped
@@ -0,0 +1,230 @@
+/**
+ *  GlobalRef.h
+ *
+ *  Handle to a global variable, or to an element of one of the super globals
+ *  (like $_SERVER['REQUEST_URI']). The key is hashed only once, when the
+ *  handle is constructed, and the handle remembers where the variable was
+ *  found. As long as the variable stays at that place, later reads and
+ *  writes do not have to look up the key again, and reading a number or a
+ *  string does not allocate anything. GlobalRef objects are normally
+ *  created as static variables:
+ *
+ *      static Php::GlobalRef uri(Php::SERVER, "REQUEST_URI");
+ *      std::string path(uri.rawValue(), uri.size());
+ *
+ *  On thread safe PHP builds the remembered place is not used, because
+ *  static handles are shared between the threads, but the precomputed hash
+ *  is still used for every lookup.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Forward declarations
+ */
+struct _zend_string;
+struct _zend_array;
+struct _Bucket;
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class PHPCPP_EXPORT GlobalRef
+{
+public:
+    /**
+     *  Constructor for a handle to a global variable
+     *  @param  name        Name of the variable (without the dollar sign)
+     *  @param  size        Size of the name
+     */
+    GlobalRef(const char *name, size_t size);
+
+    /**
+     *  Constructor for a handle to a global variable
+     *  @param  name        Name of the variable (without the dollar sign)
+     */
+    GlobalRef(const char *name) : GlobalRef(name, ::strlen(name)) {}
+
+    /**
+     *  Constructor for a handle to a global variable
+     *  @param  name        Name of the variable (without the dollar sign)
+     */
+    GlobalRef(const std::string &name) : GlobalRef(name.data(), name.size()) {}
+
+    /**
+     *  Constructor for a handle to an element of a super global
+     *  @param  super       The super global, like Php::SERVER
+     *  @param  key         Key of the element
+     *  @param  size        Size of the key
+     */
+    GlobalRef(Super &super, const char *key, size_t size);
+
+    /**
+     *  Constructor for a handle to an element of a super global
+     *  @param  super       The super global, like Php::SERVER
+     *  @param  key         Key of the element
+     */
+    GlobalRef(Super &super, const char *key) : GlobalRef(super, key, ::strlen(key)) {}
+
+    /**
+     *  Constructor for a handle to an element of a super global
+     *  @param  super       The super global, like Php::SERVER
+     *  @param  key         Key of the element
+     */
+    GlobalRef(Super &super, const std::string &key) : GlobalRef(super, key.data(), key.size()) {}
+
+    /**
+     *  Handles can not be copied, because they remember a place in the engine
+     */
+    GlobalRef(const GlobalRef &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~GlobalRef();
+
+    /**
+     *  Does the variable exist (and is it not null)?
+     *  @return bool
+     */
+    bool exists() const;
+
+    /**
+     *  The value of the variable (null if it does not exist)
+     *  @return Value
+     */
+    Value value() const;
+
+    /**
+     *  Cast to a value
+     *  @return Value
+     */
+    operator Value () const { return value(); }
+
+    /**
+     *  Typed access to the variable, these methods do not allocate, and
+     *  do not change the variable when it has a different type
+     *  @return mixed
+     */
+    int64_t numericValue() const;
+    bool boolValue() const;
+    double floatValue() const;
+
+    /**
+     *  Access to the buffer of a string variable, the pointer stays valid
+     *  until the variable is changed. For variables that do not hold a
+     *  string, a nullptr and zero size are returned.
+     *  @return const char *
+     */
+    const char *rawValue() const;
+    size_t size() const;
+
+    /**
+     *  The value of the variable as a std::string
+     *  @return std::string
+     */
+    std::string stringValue() const;
+
+    /**
+     *  Assign a new value to the variable, the variable (or the element of
+     *  the super global) is created if it did not yet exist
+     *  @param  value       The new value
+     *  @return GlobalRef
+     */
+    GlobalRef &operator=(const Value &value);
+
+    /**
+     *  Assign the value of another variable
+     *  @param  that        The other variable
+     *  @return GlobalRef
+     */
+    GlobalRef &operator=(const GlobalRef &that) { return operator=(that.value()); }
+
+    /**
+     *  Assign an integer or a string, this does not allocate anything when
+     *  the variable already exists and is not shared
+     *  @param  value       The new value
+     *  @return GlobalRef
+     */
+    GlobalRef &operator=(int64_t value);
+    GlobalRef &operator=(const char *value) { return assign(value, ::strlen(value)); }
+    GlobalRef &operator=(const std::string &value) { return assign(value.data(), value.size()); }
+
+    /**
+     *  Assign an integer of any other type (like an int, an unsigned or a
+     *  size_t), booleans and characters are not treated as integers
+     *  @param  value       The new value
+     *  @return GlobalRef
+     */
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_same<T,bool>::value && !std::is_same<T,char>::value, GlobalRef &>::type
+    operator=(T value) { return operator=((int64_t)value); }
+
+    /**
+     *  Assign a value of any other type (like a bool or a double), which is
+     *  converted to a Php::Value first, so that it keeps its type
+     *  @param  value       The new value
+     *  @return GlobalRef
+     */
+    template <typename T>
+    typename std::enable_if<!std::is_integral<T>::value || std::is_same<T,bool>::value || std::is_same<T,char>::value, GlobalRef &>::type
+    operator=(const T &value) { return operator=(Value(value)); }
+
+    /**
+     *  Assign a string value
+     *  @param  value       The new value
+     *  @param  size        Size of the value
+     *  @return GlobalRef
+     */
+    GlobalRef &assign(const char *value, size_t size);
+
+private:
+    /**
+     *  The super global that holds the variable (nullptr for globals)
+     *  @var    Super
+     */
+    Super *_super = nullptr;
+
+    /**
+     *  Name of the variable, with its hash already calculated
+     *  @var    struct _zend_string
+     */
+    struct _zend_string *_key;
+
+    /**
+     *  The bucket in which the variable was found the last time, and the
+     *  bucket in which the super global was found
+     *  @var    struct _Bucket
+     */
+    mutable struct _Bucket *_bucket = nullptr;
+    mutable struct _Bucket *_parent = nullptr;
+
+    /**
+     *  The table that holds the variable
+     *  @param  separate    Should a shared super global be separated first?
+     *  @return struct _zend_array
+     */
+    struct _zend_array *table(bool separate) const;
+
+    /**
+     *  Find the variable
+     *  @return struct _zval_struct
+     */
+    struct _zval_struct *lookup() const;
+
+    /**
+     *  Find the variable, and create it if it does not yet exist
+     *  @return struct _zval_struct
+     */
+    struct _zval_struct *create();
+};
+
+/**
+ *  End namespace
+ */
+}
@@ -90,6 +90,21 @@ public:
         _name(name), _value(std::to_string(value)), _place(place) {}
 
 
+    /**
+     *  Bind a handle to the setting, the handle is updated every time the
+     *  setting changes
+     *  @param  ref         The handle
+     *  @return Ini
+     */
+    Ini &bind(IniRef &ref)
+    {
+        // remember the handle
+        _ref = &ref;
+
+        // allow chaining
+        return *this;
+    }
+
     /**
      *  Filling ini_entries
      *  @param  ini_entry
@@ -132,7 +147,11 @@ private:
      */
     Place _place;
 
-
+    /**
+     *  The handle that is bound to the setting
+     *  @var    IniRef
+     */
+    IniRef *_ref = nullptr;
 };
 
 /**
@@ -0,0 +1,164 @@
+/**
+ *  IniRef.h
+ *
+ *  Handle to a php.ini setting of the extension. The handle is bound to the
+ *  setting when the setting is registered, and it is updated by the Zend
+ *  engine every time that the setting changes (at startup, by ini_set(), by
+ *  per-directory settings and when the original value is restored at the
+ *  end of a request). Reading the value is therefore just a memory load,
+ *  without looking up the setting by name:
+ *
+ *      static Php::IniRef limit;
+ *      extension.add(Php::Ini("my.limit", 100).bind(limit));
+ *
+ *      if (count > limit.numericValue()) { ... }
+ *
+ *  The value is converted to all types when it changes. On thread safe PHP
+ *  builds every thread has its own settings, so the handle then keeps the
+ *  converted values in a table of the current thread, and reading the value
+ *  costs an extra lookup in that table.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class PHPCPP_EXPORT IniRef
+{
+public:
+    /**
+     *  Constructor
+     */
+    IniRef() = default;
+
+    /**
+     *  Handles can not be copied, because the engine holds a pointer to them
+     *  @param  that
+     */
+    IniRef(const IniRef &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~IniRef() = default;
+
+    /**
+     *  The value as a number
+     *  @return int64_t
+     */
+    int64_t numericValue() const { return values().numeric; }
+
+    /**
+     *  The value as a floating point number
+     *  @return double
+     */
+    double floatValue() const { return values().floating; }
+
+    /**
+     *  The value as a boolean ("on", "yes" and "true" are also true)
+     *  @return bool
+     */
+    bool boolValue() const { return values().boolean; }
+
+    /**
+     *  The raw value, and its size
+     *  @return const char *
+     */
+    const char *rawValue() const { return values().string; }
+    size_t size() const { return values().size; }
+
+    /**
+     *  The value as a string
+     *  @return std::string
+     */
+    std::string stringValue() const { return std::string(values().string, values().size); }
+
+    /**
+     *  Casting operators
+     *  @return mixed
+     */
+    operator int16_t () const { return (int16_t)values().numeric; }
+    operator int32_t () const { return (int32_t)values().numeric; }
+    operator int64_t () const { return values().numeric; }
+    operator double () const { return values().floating; }
+    operator bool () const { return values().boolean; }
+    operator std::string () const { return stringValue(); }
+    operator const char * () const { return values().string; }
+
+private:
+    /**
+     *  The converted values of the setting
+     */
+    struct Values
+    {
+        /**
+         *  The value converted to a number, a floating point number and a boolean
+         *  @var    mixed
+         */
+        int64_t numeric = 0;
+        double floating = 0.0;
+        bool boolean = false;
+
+        /**
+         *  The raw value (owned by the Zend engine), and its size
+         *  @var    const char *
+         */
+        const char *string = "";
+        size_t size = 0;
+
+        /**
+         *  Were the values already set?
+         *  @var    bool
+         */
+        bool valid = false;
+    };
+
+    /**
+     *  The values (only used on builds that are not thread safe)
+     *  @var    Values
+     */
+    Values _values;
+
+    /**
+     *  Index of the values in the table of each thread (only on thread safe
+     *  builds, -1 on other builds)
+     *  @var    int
+     */
+    int _slot = -1;
+
+    /**
+     *  Name of the setting (only on thread safe builds, to find its value
+     *  in a thread in which the handle was not yet updated)
+     *  @var    std::string
+     */
+    std::string _name;
+
+    /**
+     *  The values of the current thread
+     *  @return Values
+     */
+    const Values &values() const { return _slot < 0 ? _values : local(); }
+
+    /**
+     *  The values in the table of the current thread (only on thread safe builds)
+     *  @return Values
+     */
+    const Values &local() const;
+
+    /**
+     *  The setting binds the handle, and the handler updates the values
+     */
+    friend class Ini;
+    friend struct IniHandler;
+};
+
+/**
+ *  End of namespace
+ */
+}
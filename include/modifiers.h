@@ -24,6 +24,12 @@ extern PHPCPP_EXPORT const int Protected;
 extern PHPCPP_EXPORT const int Private;
 extern PHPCPP_EXPORT const int Const;
 
+/**
+ *  Flag for methods that modify the object, used by classes that share
+ *  their C++ object with clones until it is modified (see Class::copyOnWrite())
+ */
+extern PHPCPP_EXPORT const int Mutating;
+
 /**
  *  Modifiers that are supported for methods and properties
  */
@@ -0,0 +1,167 @@
+/**
+ *  ModuleGlobals.h
+ *
+ *  Module globals of an extension: a C++ struct that the Zend engine
+ *  allocates once per process (or once per thread, on thread safe PHP
+ *  builds), and that is constructed and destructed together with the
+ *  module. Extensions that need state that should not be shared between
+ *  the threads of a thread safe build can store it in module globals,
+ *  instead of using thread_local variables (which do not work well with
+ *  SAPIs that move requests between threads).
+ *
+ *      struct Counters { int64_t calls = 0; std::string last; };
+ *
+ *      static Php::ModuleGlobals<Counters> *counters;
+ *
+ *      extern "C" PHPCPP_EXPORT void *get_module()
+ *      {
+ *          static Php::Extension extension("counters", "1.0");
+ *          counters = &extension.globals<Counters>();
+ *          ...
+ *      }
+ *
+ *      void count() { (*counters)->calls += 1; }
+ *
+ *  Access is a plain memory load on regular builds, and a lookup in the
+ *  thread's resource table on thread safe builds. An extension can have
+ *  only one globals struct (this is a restriction of the Zend engine).
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Forward declarations
+ */
+class ExtensionImpl;
+
+/**
+ *  Base class that holds the untyped storage
+ */
+class PHPCPP_EXPORT ModuleGlobalsBase
+{
+public:
+    /**
+     *  Signature of the functions that construct and destruct the struct
+     */
+    using Function = void (*)(void *globals);
+
+    /**
+     *  No copying
+     *  @param  that
+     */
+    ModuleGlobalsBase(const ModuleGlobalsBase &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~ModuleGlobalsBase();
+
+protected:
+    /**
+     *  Constructor
+     *  @param  size        Size of the struct
+     *  @param  construct   Function to construct the struct
+     *  @param  destruct    Function to destruct the struct
+     *  @param  reset       Should the struct be constructed again after each request?
+     */
+    ModuleGlobalsBase(size_t size, Function construct, Function destruct, bool reset);
+
+    /**
+     *  Pointer to the struct of this process or thread
+     *  @return void*
+     */
+    void *pointer() const { return _data ? _data : lookup(); }
+
+private:
+    /**
+     *  The storage (only on regular builds)
+     *  @var    void*
+     */
+    void *_data = nullptr;
+
+    /**
+     *  The resource id (only on thread safe builds)
+     *  @var    int
+     */
+    int _id = 0;
+
+    /**
+     *  Size of the struct
+     *  @var    size_t
+     */
+    size_t _size;
+
+    /**
+     *  Functions to construct and destruct the struct
+     *  @var    Function
+     */
+    Function _construct;
+    Function _destruct;
+
+    /**
+     *  Should the struct be constructed again after each request?
+     *  @var    bool
+     */
+    bool _reset;
+
+    /**
+     *  Find the struct of the current thread
+     *  @return void*
+     */
+    void *lookup() const;
+
+    /**
+     *  The extension registers the struct in the Zend engine
+     */
+    friend class ExtensionImpl;
+};
+
+/**
+ *  Class definition
+ */
+template <typename T>
+class ModuleGlobals : public ModuleGlobalsBase
+{
+public:
+    /**
+     *  Constructor
+     *  @param  reset       Should the struct be constructed again after each request?
+     */
+    ModuleGlobals(bool reset = false) : ModuleGlobalsBase(sizeof(T), &ModuleGlobals::construct, &ModuleGlobals::destruct, reset) {}
+
+    /**
+     *  Destructor
+     */
+    virtual ~ModuleGlobals() = default;
+
+    /**
+     *  Access to the struct
+     *  @return T
+     */
+    T &get() const { return *static_cast<T *>(pointer()); }
+    T &operator*() const { return get(); }
+    T *operator->() const { return &get(); }
+
+private:
+    /**
+     *  Construct the struct
+     *  @param  globals     Memory to construct it in
+     */
+    static void construct(void *globals) { new (globals) T(); }
+
+    /**
+     *  Destruct the struct
+     *  @param  globals     The struct
+     */
+    static void destruct(void *globals) { static_cast<T *>(globals)->~T(); }
+};
+
+/**
+ *  End of namespace
+ */
+}
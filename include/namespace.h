@@ -17,6 +17,7 @@ namespace Php {
  *  Forward declaration
  */
 class NativeFunction;
+class ExtensionImpl;
 
 /**
  *  Class definition
@@ -31,28 +32,48 @@ protected:
     std::string _name;
 
     /**
-     *  Functions defined in the namespace
-     *  @var    list
+     *  Static table of constants, with the namespace in which it is defined
      */
-    std::list<std::shared_ptr<NativeFunction>> _functions;
+    struct Table
+    {
+        std::string prefix;
+        const ConstantEntry *entries;
+        size_t count;
+    };
 
     /**
-     *  Classes defined in the namespace
-     *  @var    list
+     *  Functions defined in the namespace and in nested namespaces (the
+     *  names of the functions are fully qualified when they are added)
+     *  @var    vector
      */
-    std::list<std::shared_ptr<ClassBase>> _classes;
+    std::vector<std::shared_ptr<NativeFunction>> _functions;
 
     /**
-     *  Constants defined in the namespace
-     *  @var    list
+     *  Classes defined in the namespace and in nested namespaces, together
+     *  with the fully qualified name of the namespace that holds them
+     *  @var    vector
      */
-    std::list<std::shared_ptr<Constant>> _constants;
+    std::vector<std::pair<std::string, std::shared_ptr<ClassBase>>> _classes;
 
     /**
-     *  Namespaces defined inside the namespace
-     *  @var    list
+     *  Constants defined in the namespace and in nested namespaces, together
+     *  with the fully qualified name of the namespace that holds them
+     *  @var    vector
      */
-    std::list<std::shared_ptr<Namespace>> _namespaces;
+    std::vector<std::pair<std::string, std::shared_ptr<Constant>>> _constants;
+
+    /**
+     *  Static tables of constants defined in the namespace and in nested namespaces
+     *  @var    vector
+     */
+    std::vector<Table> _tables;
+
+    /**
+     *  Add the elements of a nested namespace to this namespace
+     *  @param  ns          The nested namespace
+     *  @param  copy        Should the functions be copied (because they are still used by the nested namespace)
+     */
+    void absorb(const Namespace &ns, bool copy);
 
     /**
      *  Add a native function directly to the namespace
@@ -107,6 +128,8 @@ public:
     template <void  (*callback)(Parameters &parameters)>    Namespace &add(const char *name, const Arguments &arguments = {}) { return add(name, &ZendCallable::invoke<callback>, arguments); }
     template <Value (*callback)()>                          Namespace &add(const char *name, const Arguments &arguments = {}) { return add(name, &ZendCallable::invoke<callback>, arguments); }
     template <Value (*callback)(Parameters &parameters)>    Namespace &add(const char *name, const Arguments &arguments = {}) { return add(name, &ZendCallable::invoke<callback>, arguments); }
+    template <Result<Value> (*callback)()>                  Namespace &add(const char *name, const Arguments &arguments = {}) { return add(name, &ZendCallable::invoke<callback>, arguments); }
+    template <Result<Value> (*callback)(Parameters &parameters)> Namespace &add(const char *name, const Arguments &arguments = {}) { return add(name, &ZendCallable::invoke<callback>, arguments); }
 
     /**
      *  Add a native function directly to the namespace
@@ -132,7 +155,7 @@ public:
         if (locked()) return *this;
 
         // make a copy of the object, and add it to the list of classes
-        _classes.push_back(std::unique_ptr<ClassBase>(new Class<T>(std::move(type))));
+        _classes.emplace_back(_name, std::shared_ptr<ClassBase>(static_cast<ClassBase*>(new Class<T>(std::move(type)))));
 
         // allow chaining
         return *this;
@@ -150,7 +173,7 @@ public:
         if (locked()) return *this;
 
         // and add it to the list of classes
-        _classes.push_back(std::unique_ptr<ClassBase>(new Class<T>(type)));
+        _classes.emplace_back(_name, std::shared_ptr<ClassBase>(static_cast<ClassBase*>(new Class<T>(type))));
 
         // allow chaining
         return *this;
@@ -167,7 +190,7 @@ public:
         if (locked()) return *this;
 
         // make a copy and add it to the list of classes
-        _classes.push_back(std::unique_ptr<ClassBase>(new Interface(std::move(interface))));
+        _classes.emplace_back(_name, std::shared_ptr<ClassBase>(static_cast<ClassBase*>(new Interface(std::move(interface)))));
 
         // allow chaining
         return *this;
@@ -184,7 +207,7 @@ public:
         if (locked()) return *this;
 
         // make a copy and add it to the list of classes
-        _classes.push_back(std::unique_ptr<ClassBase>(new Interface(interface)));
+        _classes.emplace_back(_name, std::shared_ptr<ClassBase>(static_cast<ClassBase*>(new Interface(interface))));
 
         // allow chaining
         return *this;
@@ -201,7 +224,7 @@ public:
         if (locked()) return *this;
 
         // and add it to the list of constants
-        _constants.push_back(std::unique_ptr<Constant>(new Constant(std::move(constant))));
+        _constants.emplace_back(_name, std::make_shared<Constant>(std::move(constant)));
 
         // allow chaining
         return *this;
@@ -218,12 +241,42 @@ public:
         if (locked()) return *this;
 
         // and add it to the list of constants
-        _constants.push_back(std::unique_ptr<Constant>(new Constant(constant)));
+        _constants.emplace_back(_name, std::make_shared<Constant>(constant));
+
+        // allow chaining
+        return *this;
+    }
+
+    /**
+     *  Add a static table of constants to the namespace
+     *
+     *  The table is not copied, so it must stay valid for the lifetime of
+     *  the extension (normally it is a static constexpr array).
+     *
+     *  @param  entries     The constants to add
+     *  @param  count       Number of constants
+     *  @return Namespace   Same object to allow chaining
+     */
+    Namespace &add(const ConstantEntry *entries, size_t count)
+    {
+        // skip when locked
+        if (locked()) return *this;
+
+        // add it to the list of tables
+        _tables.push_back(Table{ _name, entries, count });
 
         // allow chaining
         return *this;
     }
 
+    /**
+     *  Add a static array of constants to the namespace
+     *  @param  entries     The constants to add
+     *  @return Namespace   Same object to allow chaining
+     */
+    template <size_t N>
+    Namespace &add(const ConstantEntry (&entries)[N]) { return add(entries, N); }
+
     /**
      *  Add a namespace to the namespace by moving it
      *  @param  ns          The namespace
@@ -234,8 +287,8 @@ public:
         // skip when locked
         if (locked()) return *this;
 
-        // add it to the list of namespaces
-        _namespaces.push_back(std::unique_ptr<Namespace>(new Namespace(std::move(ns))));
+        // the elements of the namespace are moved to this namespace
+        absorb(ns, false);
 
         // allow chaining
         return *this;
@@ -251,8 +304,8 @@ public:
         // skip when locked
         if (locked()) return *this;
 
-        // make a copy and add it to the list of namespaces
-        _namespaces.push_back(std::unique_ptr<Namespace>(new Namespace(ns)));
+        // the elements of the namespace are copied to this namespace
+        absorb(ns, true);
 
         // allow chaining
         return *this;
@@ -264,14 +317,8 @@ public:
      */
     size_t functions() const
     {
-        // number of functions in this namespace
-        int result = _functions.size();
-
-        // number of functions in sub-namespace
-        for (auto &ns : _namespaces) result += ns->functions();
-
-        // done
-        return result;
+        // the functions of nested namespaces are stored here too
+        return _functions.size();
     }
 
     /**
@@ -304,6 +351,20 @@ public:
      */
     void constants(const std::function<void(const std::string &ns, Constant &constant)> &callback);
 
+    /**
+     *  Apply a callback to each static table of constants
+     *
+     *  The callback will be called with the name of the namespace, and
+     *  the entries and size of the table
+     *
+     *  @param  callback
+     */
+    void tables(const std::function<void(const std::string &ns, const ConstantEntry *entries, size_t count)> &callback);
+
+    /**
+     *  The extension walks over the elements directly
+     */
+    friend class ExtensionImpl;
 };
 
 /**
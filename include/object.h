@@ -72,6 +72,16 @@ public:
      */
     Object(struct _zend_class_entry *entry, Base *base);
 
+    /**
+     *  Constructor to create a new instance of a builtin class, for a class
+     *  that is referred to by a handle (so that the class is looked up only
+     *  once per request)
+     *
+     *  @param  classref    The class to instantiate
+     *  @param  base        C++ object to wrap
+     */
+    Object(const ClassRef &classref, Base *base);
+
     /**
      *  Wrap around an object implemented by us
      *  @param  object      Object to be wrapped
@@ -97,6 +107,17 @@ public:
     template <typename ...Args>
     Object(const char *name, Value arg0, Args&&... args) : Value() { if (instantiate(name)) call("__construct", arg0, std::forward<Value>(args)...); }
 
+    /**
+     *  Constructors to create a new instance of a class that is referred to
+     *  by a handle, these work exactly like the constructors with a name
+     *
+     *  @param  classref    The class to instantiate
+     *  @param  args        Optional arguments
+     */
+    Object(const ClassRef &classref) : Value() { if (instantiate(classref)) call("__construct"); }
+    template <typename ...Args>
+    Object(const ClassRef &classref, Value arg0, Args&&... args) : Value() { if (instantiate(classref)) call("__construct", arg0, std::forward<Value>(args)...); }
+
     /**
      *  Destructor
      */
@@ -166,6 +187,8 @@ private:
      *  @return bool
      */
     bool instantiate(const char *name);
+    bool instantiate(const ClassRef &classref);
+    bool instantiate(struct _zend_class_entry *entry);
 };
 
 /**
@@ -0,0 +1,294 @@
+/**
+ *  OutputWriter.h
+ *
+ *  Buffered writer for generating large amounts of output. Unlike Php::out,
+ *  it does not use the std::ostream machinery (no locales, sentries or
+ *  virtual calls for every insertion): strings are copied into a large
+ *  buffer, and numbers are formatted straight into that buffer. The buffer
+ *  is passed to the PHP output layer when it is full, or when flush() is
+ *  called. Strings that do not fit in the buffer are not copied at all, but
+ *  passed to the output layer right away.
+ *
+ *      Php::output << "<td>" << row.id << "</td><td>" << row.price << "</td>";
+ *      Php::output.flush();
+ *
+ *  Php::output is the writer that is also used by Php::out: when the buffer
+ *  of Php::out is full, it is moved to Php::output, and flushing Php::out
+ *  flushes Php::output too. Data that is still in the buffer at the end of
+ *  the request is flushed automatically, but output that should be mixed
+ *  with output from PHP scripts should be flushed before the script resumes.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class PHPCPP_EXPORT OutputWriter
+{
+public:
+    /**
+     *  A piece of output, for writing multiple pieces at once
+     */
+    struct Segment
+    {
+        /**
+         *  Constructors
+         *  @param  data        The data to write
+         *  @param  size        Size of the data
+         */
+        Segment(const char *data, size_t size) : data(data), size(size) {}
+        Segment(const char *data) : data(data), size(::strlen(data)) {}
+        Segment(const std::string &data) : data(data.data()), size(data.size()) {}
+
+        /**
+         *  The data
+         *  @var    const char *
+         */
+        const char *data;
+
+        /**
+         *  Size of the data
+         *  @var    size_t
+         */
+        size_t size;
+    };
+
+    /**
+     *  Constructor
+     *  @param  capacity    Size of the buffer (it is allocated on first use)
+     */
+    OutputWriter(size_t capacity = 65536) : _capacity(std::max(capacity, (size_t)64)) {}
+
+    /**
+     *  Writers can not be copied
+     *  @param  that
+     */
+    OutputWriter(const OutputWriter &that) = delete;
+    OutputWriter &operator=(const OutputWriter &that) = delete;
+
+    /**
+     *  Destructor, flushes the buffer
+     */
+    virtual ~OutputWriter();
+
+    /**
+     *  Size of the buffer
+     *  @return size_t
+     */
+    size_t capacity() const { return _capacity; }
+
+    /**
+     *  Change the size of the buffer, the data that is already in the buffer
+     *  is flushed first
+     *  @param  capacity    New size of the buffer
+     */
+    void capacity(size_t capacity);
+
+    /**
+     *  Number of bytes that are waiting in the buffer
+     *  @return size_t
+     */
+    size_t size() const { return _size; }
+
+    /**
+     *  Append data to the output
+     *  @param  data        The data to write
+     *  @param  size        Size of the data
+     *  @return OutputWriter
+     */
+    OutputWriter &append(const char *data, size_t size)
+    {
+        // small pieces of data are copied into the buffer
+        if (_buffer != nullptr && size <= _capacity - _size)
+        {
+            // copy the data
+            memcpy(_buffer + _size, data, size);
+
+            // update the size
+            _size += size;
+
+            // allow chaining
+            return *this;
+        }
+
+        // the buffer has to be allocated or flushed first
+        return write(data, size);
+    }
+
+    /**
+     *  Append data to the output
+     *  @param  data        The data to write
+     *  @return OutputWriter
+     */
+    OutputWriter &append(const char *data) { return append(data, ::strlen(data)); }
+    OutputWriter &append(const std::string &data) { return append(data.data(), data.size()); }
+
+    /**
+     *  Append a single character
+     *  @param  c           The character to write
+     *  @return OutputWriter
+     */
+    OutputWriter &append(char c)
+    {
+        // make sure there is room in the buffer
+        if (_buffer == nullptr || _size == _capacity) reserve(1);
+
+        // store the character
+        _buffer[_size++] = c;
+
+        // allow chaining
+        return *this;
+    }
+
+    /**
+     *  Append a boolean, like PHP does ("1" for true, nothing for false)
+     *  @param  value       The value to write
+     *  @return OutputWriter
+     */
+    OutputWriter &append(bool value) { return value ? append('1') : *this; }
+
+    /**
+     *  Append multiple pieces of data at once
+     *  @param  segments    The pieces to write
+     *  @return OutputWriter
+     */
+    OutputWriter &append(std::initializer_list<Segment> segments);
+
+    /**
+     *  Append a number, formatted just like PHP formats numbers
+     *  @param  value       The number to write
+     *  @return OutputWriter
+     */
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, char>::value && !std::is_same<T, bool>::value, OutputWriter&>::type
+    append(T value)
+    {
+        // signed and unsigned numbers are formatted differently
+        return std::is_signed<T>::value ? formatSigned((int64_t)value) : formatUnsigned((uint64_t)value);
+    }
+
+    /**
+     *  Append a floating point number, formatted like PHP does with the
+     *  "serialize_precision" setting (by default the shortest notation that
+     *  still holds the exact same value, like 0.1 or 1.0E+20). Note that
+     *  floats in a Php::Value are written like echo does, with the shorter
+     *  "precision" setting instead.
+     *  @param  value       The number to write
+     *  @return OutputWriter
+     */
+    OutputWriter &append(double value);
+
+    /**
+     *  Append a PHP value, strings that do not fit in the buffer are passed
+     *  to the output layer without copying them
+     *  @param  value       The value to write
+     *  @return OutputWriter
+     */
+    OutputWriter &append(const Value &value);
+
+    /**
+     *  Operator to append data, just like the other streams
+     *  @param  value       The data to write
+     *  @return OutputWriter
+     */
+    template <typename T>
+    OutputWriter &operator<<(T &&value) { return append(std::forward<T>(value)); }
+
+    /**
+     *  Publish a buffer that stays valid during the call. When no output
+     *  handlers (like ob_start() or output compression) are active, the
+     *  buffer is passed to the SAPI module as it is, without copying it
+     *  into the output buffers. Otherwise it is appended like any other
+     *  data, because the handlers take a copy anyway.
+     *  @param  data        The data to write
+     *  @param  size        Size of the data
+     *  @return OutputWriter
+     */
+    OutputWriter &publish(const char *data, size_t size);
+
+    /**
+     *  Publish a shared, immutable buffer (for example a cached response)
+     *  @param  buffer      The data to write
+     *  @return OutputWriter
+     */
+    OutputWriter &publish(const std::shared_ptr<const std::string> &buffer) { return publish(buffer->data(), buffer->size()); }
+
+    /**
+     *  Publish a PHP value, string values (including interned and
+     *  persistent strings) are published without copying them
+     *  @param  value       The value to write
+     *  @return OutputWriter
+     */
+    OutputWriter &publish(const Value &value);
+
+    /**
+     *  Pass the buffered data to the PHP output layer
+     *  @return OutputWriter
+     */
+    OutputWriter &flush();
+
+private:
+    /**
+     *  The buffer
+     *  @var    char
+     */
+    char *_buffer = nullptr;
+
+    /**
+     *  Size of the buffer
+     *  @var    size_t
+     */
+    size_t _capacity;
+
+    /**
+     *  Number of bytes that are waiting in the buffer
+     *  @var    size_t
+     */
+    size_t _size = 0;
+
+    /**
+     *  Make sure that a number of bytes can be added to the buffer
+     *  @param  size        Number of bytes that are needed
+     */
+    void reserve(size_t size);
+
+    /**
+     *  Write data that did not fit in the buffer
+     *  @param  data        The data to write
+     *  @param  size        Size of the data
+     *  @return OutputWriter
+     */
+    OutputWriter &write(const char *data, size_t size);
+
+    /**
+     *  Format numbers into the buffer
+     *  @param  value       The number to write
+     *  @return OutputWriter
+     */
+    OutputWriter &formatSigned(int64_t value);
+    OutputWriter &formatUnsigned(uint64_t value);
+
+    /**
+     *  Format a floating point number with a number of digits
+     *  @param  value       The number to write
+     *  @param  precision   Number of digits (-1 for the shortest exact notation)
+     *  @return OutputWriter
+     */
+    OutputWriter &formatFloat(double value, int precision);
+};
+
+/**
+ *  The writer that is also used by Php::out
+ */
+extern thread_local PHPCPP_EXPORT OutputWriter output;
+
+/**
+ *  End namespace
+ */
+}
@@ -0,0 +1,155 @@
+/**
+ *  PersistentScript.h
+ *
+ *  Script that is compiled only once, and that can then be executed in every
+ *  later request. This is useful for fixed PHP code that is embedded in an
+ *  extension, and that would otherwise be compiled over and over again.
+ *
+ *  The script is compiled the first time that it is executed, and the
+ *  compiled code is then copied to persistent memory. This is only possible
+ *  for scripts that do not declare functions, closures or classes, and only
+ *  on non-thread-safe PHP 8 builds. Other scripts are compiled once in every
+ *  request instead (using the same cache as Php::Script).
+ *
+ *  PersistentScript objects are normally created as static variables in
+ *  the extension, so that they stay in scope for the lifetime of the process.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Forward declarations
+ */
+class PersistentOpcodes;
+class Scope;
+
+/**
+ *  Class definition
+ */
+class PHPCPP_EXPORT PersistentScript
+{
+public:
+    /**
+     *  Constructor
+     *
+     *  The constructor does not yet compile the script, this happens when
+     *  it is executed for the first time.
+     *
+     *  @param  name        Name of the PHP script
+     *  @param  source      PHP source code to be evaluated
+     *  @param  size        Length of the source code
+     */
+    PersistentScript(const char *name, const char *source, size_t size) : _name(name), _source(source, size) {}
+
+    /**
+     *  Alternative constructor without a size
+     *  @param  name        Name of the PHP script
+     *  @param  source      PHP source code to be evaluated
+     */
+    PersistentScript(const char *name, const char *source) : PersistentScript(name, source, ::strlen(source)) {}
+
+    /**
+     *  Alternative constructor without a name
+     *  @param  source      PHP source code to be evaluated
+     *  @param  size        Length of the source code
+     */
+    PersistentScript(const char *source, size_t size) : PersistentScript("Unknown", source, size) {}
+
+    /**
+     *  Alternative constructor without a name and without a size
+     *  @param  source      PHP source code to be evaluated
+     */
+    PersistentScript(const char *source) : PersistentScript("Unknown", source, ::strlen(source)) {}
+
+    /**
+     *  Constructor based on a std::string
+     *  @param  source      PHP source code to be evaluated
+     */
+    PersistentScript(const std::string &source) : PersistentScript("Unknown", source.c_str(), source.size()) {}
+
+    /**
+     *  The script can not be copied
+     *  @param  that
+     */
+    PersistentScript(const PersistentScript &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~PersistentScript();
+
+    /**
+     *  Is the compiled script kept in persistent memory? This is only known
+     *  after the script was executed for the first time.
+     *  @return bool
+     */
+    bool persistent() const { return _opcodes != nullptr; }
+
+    /**
+     *  Execute the script
+     *  The return value of the script is returned
+     *  @return Value
+     */
+    Value execute();
+
+    /**
+     *  Execute the script in an isolated scope
+     *
+     *  The script only sees the variables in the scope, and not the ones of
+     *  the calling function. Variables that the script assigns are stored in
+     *  the scope.
+     *
+     *  @param  scope       The scope with the variables
+     *  @return Value
+     */
+    Value execute(Scope &scope);
+
+private:
+    /**
+     *  Name of the script
+     *  @var    std::string
+     */
+    std::string _name;
+
+    /**
+     *  The source code
+     *  @var    std::string
+     */
+    std::string _source;
+
+    /**
+     *  Was the script already compiled?
+     *  @var    bool
+     */
+    bool _compiled = false;
+
+    /**
+     *  The compiled script in persistent memory
+     *  @var    PersistentOpcodes
+     */
+    PersistentOpcodes *_opcodes = nullptr;
+
+    /**
+     *  Execute the script
+     *  @param  symbols     Symbol table of an isolated scope, or nullptr
+     *  @return Value
+     */
+    Value execute(struct _zend_array *symbols);
+
+    /**
+     *  Compile the script for the first time, and execute it
+     *  @param  symbols     Symbol table of an isolated scope, or nullptr
+     *  @return Value
+     */
+    Value compile(struct _zend_array *symbols);
+};
+
+/**
+ *  End of namespace
+ */
+}
@@ -0,0 +1,216 @@
+/**
+ *  Result.h
+ *
+ *  Return value of a function that reports errors with a status instead of
+ *  with C++ exceptions. Functions and methods that return a Php::Result can
+ *  be registered just like functions that return a Php::Value, and when an
+ *  error is returned, PHP-CPP throws the PHP exception without unwinding
+ *  the C++ stack first:
+ *
+ *      Php::Result<Php::Value> validate(Php::Parameters &params)
+ *      {
+ *          if (params[0].size() > 10) return Php::Exception("too long");
+ *
+ *          auto result = params[1].tryInvoke(params[0]);
+ *          if (!result) return result;
+ *
+ *          return result.value().boolValue();
+ *      }
+ *
+ *  The Value::tryCall() and Value::tryInvoke() methods call PHP code in the
+ *  same way. When the PHP code throws, the PHP exception is left pending in
+ *  the engine and the result is marked as pending, so that it can be passed
+ *  back to PHP as-is. Call discard() to ignore the PHP exception instead.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Base class that holds the status
+ */
+class PHPCPP_EXPORT ResultBase
+{
+public:
+    /**
+     *  The possible states
+     */
+    enum class Status : unsigned char {
+        Success,        // the function succeeded
+        Pending,        // a PHP exception is pending in the engine
+        Exception,      // a Php::Exception should be thrown
+        Error           // a Php::Error should be thrown
+    };
+
+    /**
+     *  Destructor
+     */
+    virtual ~ResultBase() = default;
+
+    /**
+     *  Did the function succeed?
+     *  @return bool
+     */
+    bool ok() const { return _status == Status::Success; }
+    explicit operator bool () const { return ok(); }
+
+    /**
+     *  Is a PHP exception pending?
+     *  @return bool
+     */
+    bool pending() const { return _status == Status::Pending; }
+
+    /**
+     *  The status
+     *  @return Status
+     */
+    Status status() const { return _status; }
+
+    /**
+     *  The error message and code (this reads the properties of the PHP
+     *  exception when it is pending)
+     *  @return mixed
+     */
+    std::string message() const;
+    long int code() const;
+
+    /**
+     *  Remove the pending PHP exception from the engine, so that the script
+     *  continues as if the exception was caught. The message and the code of
+     *  the exception remain available, and the result turns into a regular
+     *  exception or error (which is thrown again when it is returned to PHP)
+     */
+    void discard();
+
+protected:
+    /**
+     *  Constructor
+     *  @param  status      The status
+     */
+    ResultBase(Status status = Status::Success) : _status(status) {}
+
+    /**
+     *  Constructor for an exception or error that is thrown when the result
+     *  is returned to PHP, a caught PHP exception is left pending in the engine
+     *  @param  throwable   The exception or error
+     */
+    ResultBase(const Throwable &throwable);
+
+private:
+    /**
+     *  The status
+     *  @var    Status
+     */
+    Status _status;
+
+    /**
+     *  The exception code
+     *  @var    long int
+     */
+    long int _code = 0;
+
+    /**
+     *  The exception message
+     *  @var    std::string
+     */
+    std::string _message;
+};
+
+/**
+ *  Class definition
+ */
+template <typename T = Value>
+class Result : public ResultBase
+{
+public:
+    /**
+     *  Constructor for a successful result
+     *  @param  value       The return value
+     */
+    template <typename X, typename = typename std::enable_if<std::is_constructible<T, X&&>::value>::type>
+    Result(X &&value) : _value(std::forward<X>(value)) {}
+
+    /**
+     *  Constructor for a successful result without a value
+     */
+    Result() = default;
+
+    /**
+     *  Constructor for an exception or error that is thrown when the result
+     *  is returned to PHP
+     *  @param  throwable   The exception or error
+     */
+    Result(const Throwable &throwable) : ResultBase(throwable) {}
+
+    /**
+     *  Result of a function that leaves a PHP exception pending
+     *  @return Result
+     */
+    static Result failed() { return Result(Status::Pending); }
+
+    /**
+     *  Destructor
+     */
+    virtual ~Result() = default;
+
+    /**
+     *  The return value (only meaningful when the result is ok)
+     *  @return T
+     */
+    const T &value() const { return _value; }
+    T &value() { return _value; }
+
+private:
+    /**
+     *  The return value
+     *  @var    T
+     */
+    T _value{};
+
+    /**
+     *  Constructor
+     *  @param  status      The status
+     */
+    Result(Status status) : ResultBase(status) {}
+};
+
+/**
+ *  Call the function, without throwing a C++ exception when the PHP code throws
+ *  (this is defined here, because the result class is not yet complete in value.h)
+ *  @param  args        Optional arguments
+ *  @return Result<Value>
+ */
+template <typename ...Args>
+Result<Value> Value::tryInvoke(Args&&... args) const
+{
+    // store arguments
+    Value vargs[] = { static_cast<Value>(args)... };
+
+    // call the function
+    return tryExec(sizeof...(Args), vargs);
+}
+
+/**
+ *  Call a method, without throwing a C++ exception when the PHP code throws
+ *  @param  name        Name of the method
+ *  @param  args        Optional arguments
+ *  @return Result<Value>
+ */
+template <typename ...Args>
+Result<Value> Value::tryCall(const char *name, Args&&... args) const
+{
+    // store arguments
+    Value vargs[] = { static_cast<Value>(args)... };
+
+    // call the method
+    return tryExec(name, sizeof...(Args), vargs);
+}
+
+/**
+ *  End namespace
+ */
+}
@@ -0,0 +1,113 @@
+/**
+ *  Scope.h
+ *
+ *  Variables of an isolated scope in which a script can be executed. When a
+ *  script is executed in a scope, it does not see the variables of the
+ *  calling function (so there is no need to build a symbol table for the
+ *  caller), but only the variables in the scope. The variables that the
+ *  script assigns are stored in the scope, so the scope can be inspected
+ *  afterwards, and it can be used again for the next execution.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class PHPCPP_EXPORT Scope
+{
+public:
+    /**
+     *  Constructor for an empty scope
+     */
+    Scope() = default;
+
+    /**
+     *  Constructor with initial variables
+     *  @param  variables   Array of variables, indexed by name
+     */
+    Scope(const Array &variables) : _variables(variables) {}
+
+    /**
+     *  Destructor
+     */
+    virtual ~Scope() = default;
+
+    /**
+     *  Add variables to the scope, existing variables with the same name
+     *  are overwritten
+     *  @param  variables   Array of variables, indexed by name
+     *  @return Scope
+     */
+    Scope &assign(const Array &variables);
+
+    /**
+     *  Set a single variable
+     *  @param  name        Name of the variable
+     *  @param  value       The new value
+     *  @return Scope
+     */
+    Scope &set(const std::string &name, const Value &value)
+    {
+        // update the array
+        _variables.set(name, value);
+
+        // allow chaining
+        return *this;
+    }
+
+    /**
+     *  Retrieve a variable
+     *  @param  name        Name of the variable
+     *  @return Value
+     */
+    Value get(const std::string &name) const { return _variables.get(name); }
+
+    /**
+     *  Is a variable set?
+     *  @param  name        Name of the variable
+     *  @return bool
+     */
+    bool contains(const std::string &name) const { return _variables.contains(name); }
+
+    /**
+     *  All variables in the scope
+     *  @return Array
+     */
+    const Array &variables() const { return _variables; }
+
+    /**
+     *  Remove all variables
+     */
+    void clear() { _variables = Array(); }
+
+private:
+    /**
+     *  The variables
+     *  @var    Array
+     */
+    Array _variables;
+
+    /**
+     *  The symbol table that is used when a script is executed
+     *  @return struct _zend_array
+     */
+    struct _zend_array *symbols();
+
+    /**
+     *  The classes that execute scripts need the symbol table
+     */
+    friend class Script;
+    friend class PersistentScript;
+    friend class File;
+};
+
+/**
+ *  End of namespace
+ */
+}
@@ -24,6 +24,7 @@ namespace Php {
  *  Forward declarations
  */
 class Opcodes;
+class Scope;
 
 /**
  *  Class definition
@@ -88,12 +89,38 @@ public:
      */
     Value execute() const;
 
+    /**
+     *  Execute the script in an isolated scope
+     *
+     *  The script only sees the variables in the scope, and not the ones of
+     *  the calling function. Variables that the script assigns are stored in
+     *  the scope.
+     *
+     *  @param  scope       The scope with the variables
+     *  @return Value
+     */
+    Value execute(Scope &scope) const;
+
+    /**
+     *  Statistics of the cache of compiled scripts of the current thread
+     *
+     *  Scripts that are evaluated more than once in the same request are
+     *  only compiled the first time. The size of the cache can be set with
+     *  the "phpcpp.eval_cache" (max number of scripts) and the
+     *  "phpcpp.eval_cache_size" (max total bytes of source code) php.ini
+     *  settings. This method returns an array with the number of "hits",
+     *  "misses" and "evictions", and the current "entries" and "bytes".
+     *
+     *  @return Value
+     */
+    static Value statistics();
+
 private:
     /**
-     *  The opcodes
-     *  @var Opcodes
+     *  The opcodes, these may be shared with the cache of compiled scripts
+     *  @var std::shared_ptr<Opcodes>
      */
-    Opcodes *_opcodes;
+    std::shared_ptr<Opcodes> _opcodes;
 
     /**
      *  Helper function to compile the source code
@@ -104,6 +131,11 @@ private:
      */
     static struct _zend_op_array *compile(const char *name, const char *phpcode, size_t size);
 
+    /**
+     *  The persistent script uses the same compiler
+     */
+    friend class PersistentScript;
+
 };
 
 /**
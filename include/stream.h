@@ -6,9 +6,9 @@
  *  from which data can be read and/or to which data can be sent.
  * 
  *  This Php::Stream class can be used to wrap around a value (if that
- *  value contains a stream) to access stream-specific properties. This
- *  class currently has a very limited API, but more features can be
- *  added if needed.
+ *  value contains a stream) to access stream-specific properties, and to
+ *  read and write data without converting it into PHP strings. Plain
+ *  files can also be mapped into memory.
  * 
  *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
  *  @copyright 2019 Copernica BV
@@ -47,6 +47,12 @@ private:
      */
     struct _php_stream *_stream;
 
+    /**
+     *  Is (part of) the stream mapped into memory?
+     *  @var bool
+     */
+    bool _mapped = false;
+
 public:
     /**
      *  Constructor
@@ -80,6 +86,66 @@ public:
      *  @return int
      */
     int fd() const;
+
+    /**
+     *  Read data from the stream into a buffer, data that is already in the
+     *  read-buffer is used first. In non-blocking mode, this returns zero
+     *  when no data is available.
+     *  @param  buffer      buffer to read into
+     *  @param  size        size of the buffer
+     *  @return size_t      number of bytes read
+     */
+    size_t read(char *buffer, size_t size);
+
+    /**
+     *  Write data to the stream
+     *  @param  buffer      data to write
+     *  @param  size        size of the data
+     *  @return size_t      number of bytes written
+     */
+    size_t write(const char *buffer, size_t size);
+
+    /**
+     *  Access to the read-buffer, without copying the data. The buffer holds
+     *  readbuffer() bytes, and stays valid until the stream is read again.
+     *  @return const char *
+     */
+    const char *peek() const;
+
+    /**
+     *  Remove data from the read-buffer, after it was processed with peek()
+     *  @param  size        number of bytes to remove (at most readbuffer())
+     */
+    void consume(size_t size);
+
+    /**
+     *  Is the end of the stream reached?
+     *  @return bool
+     */
+    bool eof() const;
+
+    /**
+     *  Switch between blocking and non-blocking mode
+     *  @param  blocking    should the stream block?
+     *  @return bool        was the mode set? (false if the stream does not support it)
+     */
+    bool blocking(bool blocking);
+
+    /**
+     *  Map (part of) the stream into memory. This is only supported for
+     *  plain files (and some other wrappers). The mapping is removed when
+     *  unmap() is called, or when the Stream object is destructed.
+     *  @param  offset      start of the mapping
+     *  @param  length      number of bytes to map (0 for the rest of the file)
+     *  @param  size        is filled with the number of bytes that were mapped
+     *  @return const char *    the mapped data, or nullptr if the stream can not be mapped
+     */
+    const char *map(size_t offset, size_t length, size_t *size);
+
+    /**
+     *  Remove the mapping
+     */
+    void unmap();
 };
     
 /**
@@ -8,6 +8,11 @@
  *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
  */
 
+/**
+ *  Forward declarations
+ */
+struct _zend_string;
+
 /**
  *  Set up namespace
  */
@@ -28,12 +33,12 @@ public:
      *  @param  index   index number
      *  @param  name    name of the variable in PHP
      */
-    Super(int index, const char *name) : _index(index), _name(name) {}
+    Super(int index, const char *name);
 
     /**
      *  Destructor
      */
-    virtual ~Super() {}
+    virtual ~Super();
 
     /**
      *  Array access operator
@@ -97,10 +102,10 @@ private:
     int _index;
 
     /**
-     *  Name of the variable in PHP
-     *  @var    name
+     *  Name of the variable in PHP, with its hash already calculated
+     *  @var    struct _zend_string
      */
-    const char *_name;
+    struct _zend_string *_key;
 
     /**
      *  Turn the object into a value object
@@ -108,6 +113,10 @@ private:
      */
     Value value();
 
+    /**
+     *  The GlobalRef class looks up the super global in the symbol table
+     */
+    friend class GlobalRef;
 };
 
 /**
@@ -33,7 +33,28 @@ protected:
      *  @var long int
      */
     long int _code = -1;
-    
+
+private:
+    /**
+     *  The PHP exception object that is wrapped (nullptr if the exception
+     *  was created in C++), its message and code are only read when needed.
+     *  The object belongs to the request, so an exception that wraps it may
+     *  not outlive the request (copies do not wrap the object)
+     *  @var struct _zend_object
+     */
+    struct _zend_object *_object = nullptr;
+
+    /**
+     *  The message of the PHP exception, once it was read
+     *  @var std::string
+     */
+    mutable std::string _message;
+
+    /**
+     *  Was the message of the PHP exception already read?
+     *  @var bool
+     */
+    mutable bool _converted = false;
 
 protected:
     /**
@@ -49,10 +70,30 @@ protected:
     Throwable(struct _zend_object *object);
 
 public:
+    /**
+     *  Copy constructor, the copy holds the message and the code of a
+     *  wrapped PHP exception, so that it can outlive the request
+     *  @param  that
+     */
+    Throwable(const Throwable &that);
+
     /**
      *  Destructor
      */
-    virtual ~Throwable() = default;
+    virtual ~Throwable();
+
+    /**
+     *  Assignment operator
+     *  @param  that
+     *  @return Throwable
+     */
+    Throwable &operator=(const Throwable &that);
+
+    /**
+     *  The exception message
+     *  @return const char *
+     */
+    virtual const char *what() const _NOEXCEPT override;
     
     /**
      *  Rethrow the exception / make sure that it ends up in PHP space
@@ -63,11 +104,7 @@ public:
      *  Returns the exception code
      *  @return The exception code
      */
-    long int code() const _NOEXCEPT
-    {
-        // expose the code
-        return _code;
-    }
+    long int code() const _NOEXCEPT;
 };
 
 /**
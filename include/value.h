@@ -32,6 +32,8 @@ namespace Php {
  *  Forward definitions
  */
 class Base;
+class ClassRef;
+template <typename T> class Result;
 class ValueIterator;
 class Parameters;
 template <class Type> class HashMember;
@@ -1056,6 +1058,29 @@ public:
         return exec(name, sizeof...(Args), vargs);
     }
 
+    /**
+     *  Call the function, without throwing a C++ exception when the PHP code
+     *  throws: the PHP exception is left pending, and the result is marked
+     *  as pending (see Php::Result)
+     *  @param  args        Optional arguments
+     *  @return Result<Value>
+     */
+    Result<Value> tryInvoke() const;
+    template <typename ...Args>
+    Result<Value> tryInvoke(Args&&... args) const;
+
+    /**
+     *  Call a method, without throwing a C++ exception when the PHP code
+     *  throws: the PHP exception is left pending, and the result is marked
+     *  as pending (see Php::Result)
+     *  @param  name        Name of the method
+     *  @param  args        Optional arguments
+     *  @return Result<Value>
+     */
+    Result<Value> tryCall(const char *name) const;
+    template <typename ...Args>
+    Result<Value> tryCall(const char *name, Args&&... args) const;
+
     /**
      *  Retrieve the original implementation
      *
@@ -1099,6 +1124,7 @@ public:
     bool instanceOf(const char *classname, size_t size, bool allowString = false) const;
     bool instanceOf(const char *classname, bool allowString = false) const { return instanceOf(classname, strlen(classname), allowString); }
     bool instanceOf(const std::string &classname, bool allowString = false) const { return instanceOf(classname.c_str(), classname.size(), allowString); }
+    bool instanceOf(const ClassRef &classref, bool allowString = false) const;
 
     /**
      *  Check whether this object is derived from a certain class.
@@ -1114,6 +1140,7 @@ public:
     bool derivedFrom(const char *classname, size_t size, bool allowString = false) const;
     bool derivedFrom(const char *classname, bool allowString = false) const { return derivedFrom(classname, strlen(classname), allowString); }
     bool derivedFrom(const std::string &classname, bool allowString = false) const { return derivedFrom(classname.c_str(), classname.size(), allowString); }
+    bool derivedFrom(const ClassRef &classref, bool allowString = false) const;
 
     /**
      * @internal
@@ -1145,6 +1172,17 @@ private:
     Value exec(const char *name, int argc, Value *argv) const;
     Value exec(const char *name, int argc, Value *argv);
 
+    /**
+     *  Call function or method with a number of parameters, without throwing
+     *  when the PHP code throws
+     *  @param  name        Name of method to call
+     *  @param  argc        Number of parameters
+     *  @param  argv        The parameters
+     *  @return Result<Value>
+     */
+    Result<Value> tryExec(int argc, Value *argv) const;
+    Result<Value> tryExec(const char *name, int argc, Value *argv) const;
+
     /**
      *  Refcount - the number of references to the value
      *  @return int
@@ -1229,6 +1267,7 @@ protected:
      *  The Globals and Member classes can access the zval directly
      */
     friend class Globals;
+    friend class GlobalRef;
     friend class Member;
     friend class ClassImpl;
     friend class IteratorImpl;
@@ -1238,8 +1277,10 @@ protected:
     friend class HashMember<int>;
     friend class HashMember<std::string>;
     friend class Callable;
+    friend class Functor;
     friend class ZendCallable;
     friend class Script;
+    friend class Scope;
     friend class ConstantImpl;
     friend class Stream;
 
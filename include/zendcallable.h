@@ -71,6 +71,7 @@ private:
      */
     static void yield(struct _zval_struct *return_value, std::nullptr_t value);
     static void yield(struct _zval_struct *return_value, const Php::Value &value);
+    static void yield(struct _zval_struct *return_value, const Result<Value> &result);
 public:
     /**
      *  Execute the callback
@@ -296,6 +297,118 @@ public:
         }
     }
 
+    /**
+     *  Execute the callback
+     *
+     *  @param  execute_data    Data about the PHP call stack
+     *  @param  return_value    The value we are returning to PHP
+     */
+    template <typename T, Result<Value> (T::*callback)()>
+    static void invoke(struct _zend_execute_data *execute_data, struct _zval_struct *return_value)
+    {
+        // catch exceptions thrown by the C++ methods
+        try
+        {
+            // cast the base to the correct object and invoke the member
+            auto result = (static_cast<T*>(instance(execute_data))->*callback)();
+
+            // store the return value, or report the error
+            yield(return_value, result);
+        }
+        catch (Throwable &throwable)
+        {
+            // handle the exception
+            handle(throwable);
+        }
+    }
+
+    /**
+     *  Execute the callback
+     *
+     *  @param  execute_data    Data about the PHP call stack
+     *  @param  return_value    The value we are returning to PHP
+     */
+    template <typename T, Result<Value> (T::*callback)() const>
+    static void invoke(struct _zend_execute_data *execute_data, struct _zval_struct *return_value)
+    {
+        // catch exceptions thrown by the C++ methods
+        try
+        {
+            // cast the base to the correct object and invoke the member
+            auto result = (static_cast<T*>(instance(execute_data))->*callback)();
+
+            // store the return value, or report the error
+            yield(return_value, result);
+        }
+        catch (Throwable &throwable)
+        {
+            // handle the exception
+            handle(throwable);
+        }
+    }
+
+    /**
+     *  Execute the callback
+     *
+     *  @param  execute_data    Data about the PHP call stack
+     *  @param  return_value    The value we are returning to PHP
+     */
+    template <typename T, Result<Value> (T::*callback)(Parameters &parameters)>
+    static void invoke(struct _zend_execute_data *execute_data, struct _zval_struct *return_value)
+    {
+        // check parameter count
+        if (!valid(execute_data, return_value)) return;
+
+        // retrieve the parameters
+        auto params = parameters(execute_data);
+
+        // catch exceptions thrown by the C++ methods
+        try
+        {
+            // cast the base to the correct object and invoke the member
+            auto result = (static_cast<T*>(instance(execute_data))->*callback)(params);
+
+            // store the return value, or report the error
+            yield(return_value, result);
+        }
+        catch (Throwable &throwable)
+        {
+            // handle the exception
+            handle(throwable);
+        }
+    }
+
+    /**
+     *  Execute the callback
+     *
+     *  @param  execute_data    Data about the PHP call stack
+     *  @param  return_value    The value we are returning to PHP
+     */
+    template <typename T, Result<Value> (T::*callback)(Parameters &parameters) const>
+    static void invoke(struct _zend_execute_data *execute_data, struct _zval_struct *return_value)
+    {
+        // check parameter count
+        if (!valid(execute_data, return_value)) return;
+
+        // retrieve the parameters
+        auto params = parameters(execute_data);
+
+        // catch exceptions thrown by the C++ methods
+        try
+        {
+            // cast the base to the correct object and invoke the member
+            auto result = (static_cast<T*>(instance(execute_data))->*callback)(params);
+
+            // store the return value, or report the error
+            yield(return_value, result);
+        }
+        catch (Throwable &throwable)
+        {
+            // handle the exception
+            handle(throwable);
+        }
+    }
+
     /**
      *  Execute the callback
      *
@@ -407,6 +520,62 @@ public:
             handle(throwable);
         }
     }
+
+    /**
+     *  Execute the callback
+     *
+     *  @param  execute_data    data about the PHP call stack
+     *  @param  return_value    The value we are returning to PHP
+     */
+    template <Result<Value>(*callback)()>
+    static void invoke(struct _zend_execute_data *execute_data, struct _zval_struct *return_value)
+    {
+        // catch exceptions thrown by the C++ methods
+        try
+        {
+            // execute the callback
+            auto result = callback();
+
+            // store the return value, or report the error
+            yield(return_value, result);
+        }
+        catch (Throwable &throwable)
+        {
+            // handle the exception
+            handle(throwable);
+        }
+    }
+
+    /**
+     *  Execute the callback
+     *
+     *  @param  execute_data    data about the PHP call stack
+     *  @param  return_value    The value we are returning to PHP
+     */
+    template <Result<Value>(*callback)(Parameters &parameters)>
+    static void invoke(struct _zend_execute_data *execute_data, struct _zval_struct *return_value)
+    {
+        // check parameter count
+        if (!valid(execute_data, return_value)) return;
+
+        // retrieve the parameters
+        auto params = parameters(execute_data);
+
+        // catch exceptions thrown by the C++ methods
+        try
+        {
+            // execute the callback
+            auto result = callback(params);
+
+            // store the return value, or report the error
+            yield(return_value, result);
+        }
+        catch (Throwable &throwable)
+        {
+            // handle the exception
+            handle(throwable);
+        }
+    }
 };
 
 /**
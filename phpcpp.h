@@ -23,6 +23,7 @@
 #include <map>
 #include <set>
 #include <functional>
+#include <type_traits>
 
 /**
  *  Include all headers files that are related to this library
@@ -34,6 +35,8 @@
 #include <phpcpp/platform.h>
 #include <phpcpp/version.h>
 #include <phpcpp/inivalue.h>
+#include <phpcpp/iniref.h>
+#include <phpcpp/moduleglobals.h>
 #include <phpcpp/ini.h>
 #include <phpcpp/throwable.h>
 #include <phpcpp/exception.h>
@@ -46,6 +49,7 @@
 #include <phpcpp/valueiterator.h>
 #include <phpcpp/array.h>
 #include <phpcpp/object.h>
+#include <phpcpp/result.h>
 #include <phpcpp/globals.h>
 #include <phpcpp/argument.h>
 #include <phpcpp/byval.h>
@@ -53,6 +57,7 @@
 #include <phpcpp/global.h>
 #include <phpcpp/hashmember.h>
 #include <phpcpp/super.h>
+#include <phpcpp/globalref.h>
 #include <phpcpp/parameters.h>
 #include <phpcpp/modifiers.h>
 #include <phpcpp/base.h>
@@ -64,15 +69,22 @@
 #include <phpcpp/classtype.h>
 #include <phpcpp/classbase.h>
 #include <phpcpp/constant.h>
+#include <phpcpp/constantentry.h>
+#include <phpcpp/constantref.h>
+#include <phpcpp/classref.h>
 #include <phpcpp/interface.h>
 #include <phpcpp/zendcallable.h>
 #include <phpcpp/class.h>
 #include <phpcpp/namespace.h>
 #include <phpcpp/extension.h>
 #include <phpcpp/call.h>
+#include <phpcpp/scope.h>
 #include <phpcpp/script.h>
+#include <phpcpp/persistentscript.h>
 #include <phpcpp/file.h>
+#include <phpcpp/closure.h>
 #include <phpcpp/function.h>
 #include <phpcpp/stream.h>
+#include <phpcpp/outputwriter.h>
 
 #endif /* phpcpp.h */
@@ -294,6 +294,28 @@ Php::Value Base::__getIterator()
     return this;
 }
 
+/**
+ *  Export the properties of the object
+ *  @param  properties  Array to which the properties are added
+ */
+void Base::__properties(Php::Array &properties) const
+{
+    // throw an exception that will be caught in the ClassImpl class,
+    // so that the default implementation of the function can be called
+    throw NotImplemented();
+}
+
+/**
+ *  Export the properties of the object for debugging
+ *  @param  properties  Array to which the properties are added
+ */
+void Base::__debugInfo(Php::Array &properties) const
+{
+    // throw an exception that will be caught in the ClassImpl class,
+    // so that the default implementation of the function can be called
+    throw NotImplemented();
+}
+
 /**
  *  End namespace
  */
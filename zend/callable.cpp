@@ -24,56 +24,142 @@ namespace Php {
  */
 void Callable::invoke(INTERNAL_FUNCTION_PARAMETERS)
 {
-    uint32_t argc       = EX(func)->common.num_args;
-    zend_arg_info* info = EX(func)->common.arg_info;
+    // find the callable
+    Callable *callable = lookup(EX(func));
+
+    // check if sufficient parameters were passed
+    if (!callable->sufficient(execute_data, return_value)) return;
+
+    // construct parameters
+    ParametersImpl params(getThis(), ZEND_NUM_ARGS());
+
+    // the function could throw an exception
+    try
+    {
+        // get the result, and pass it on
+        yield(return_value, callable->invoke(params));
+    }
+    catch (Throwable &throwable)
+    {
+        // an exception was not caught by the extension, let it bubble up
+        throwable.rethrow();
+    }
+}
+
+/**
+ *  Check if sufficient parameters were passed, a warning is reported and
+ *  the return value is set to null if this is not the case
+ *  @param  execute_data
+ *  @param  return_value
+ *  @return bool
+ */
+bool Callable::sufficient(zend_execute_data *execute_data, zval *return_value) const
+{
+    // check if sufficient parameters were passed (for some reason this check
+    // is not done by Zend, so we do it here ourselves)
+    if (ZEND_NUM_ARGS() >= _required) return true;
+
+    // PHP itself only generates a warning when this happens, so we do the same too
+    Php::warning << get_active_function_name() << "() expects at least " << _required << " parameter(s), " << ZEND_NUM_ARGS() << " given" << std::flush;
+
+    // and we return null
+    RETVAL_NULL();
+
+    // the function should not be called
+    return false;
+}
+
+/**
+ *  The parameters that were passed to the function
+ *  @param  execute_data
+ *  @return Parameters
+ */
+Parameters Callable::parameters(zend_execute_data *execute_data)
+{
+    // construct the parameters
+    return ParametersImpl(getThis(), ZEND_NUM_ARGS());
+}
+
+/**
+ *  Pass the return value to the Zend engine
+ *  @param  return_value
+ *  @param  value
+ */
+void Callable::yield(zval *return_value, const Value &value)
+{
+    // return a full copy of the zval, and do not destruct it
+    RETVAL_ZVAL(value._val, 1, 0);
+}
+
+/**
+ *  Reserved slot in zend_internal_function in which the callable is stored
+ *  @var    int
+ */
+int Callable::_slot = -1;
+
+/**
+ *  Find the callable that was hidden in the argument info of a function
+ *  @param  function    The function that is called
+ *  @return Callable
+ */
+Callable *Callable::find(const zend_function *function)
+{
+    uint32_t argc       = function->common.num_args;
+    zend_arg_info* info = function->common.arg_info;
 
 #if PHP_VERSION_ID < 70200
     // Sanity check
     assert(info[argc].class_name != nullptr && info[argc].name == nullptr);
 
     // the callable we are retrieving
-    Callable *callable = reinterpret_cast<Callable*>(info[argc].class_name);
+    return reinterpret_cast<Callable*>(info[argc].class_name);
 #else
     // Sanity check
     assert(ZEND_TYPE_IS_SET(info[argc].type) && info[argc].name == nullptr);
     // the callable we are retrieving
 # if PHP_VERSION_ID < 80000
-    Callable *callable = reinterpret_cast<Callable*>(info[argc].type);
+    return reinterpret_cast<Callable*>(info[argc].type);
 # else
-    Callable *callable = reinterpret_cast<Callable*>(info[argc].type.ptr);
+    return reinterpret_cast<Callable*>(info[argc].type.ptr);
 # endif
 #endif
+}
 
-    // check if sufficient parameters were passed (for some reason this check
-    // is not done by Zend, so we do it here ourselves)
-    if (ZEND_NUM_ARGS() < callable->_required)
-    {
-        // PHP itself only generates a warning when this happens, so we do the same too
-        Php::warning << get_active_function_name() << "() expects at least " << callable->_required << " parameter(s), " << ZEND_NUM_ARGS() << " given" << std::flush;
+/**
+ *  Store a pointer to this object in a reserved slot of the function that
+ *  the Zend engine has registered, so that invoke() can find it directly
+ *
+ *  @param  table       The function table in which the function was registered
+ */
+void Callable::install(HashTable *table) const
+{
+    // functions with their own callback do not need the pointer
+    if (_callback) return;
 
-        // and we return null
-        RETURN_NULL();
-    }
-    else
-    {
-        // construct parameters
-        ParametersImpl params(getThis(), ZEND_NUM_ARGS());
-
-        // the function could throw an exception
-        try
-        {
-            // get the result
-            Value result(callable->invoke(params));
-
-            // return a full copy of the zval, and do not destruct it
-            RETVAL_ZVAL(result._val, 1, 0);
-        }
-        catch (Throwable &throwable)
-        {
-            // an exception was not caught by the extension, let it bubble up
-            throwable.rethrow();
-        }
-    }
+    // claim a reserved slot the first time (this happens at startup)
+#if PHP_VERSION_ID < 80000
+    static zend_extension extension;
+    static int slot = zend_get_resource_handle(&extension);
+#else
+    static int slot = zend_get_resource_handle("PHP-CPP");
+#endif
+
+    // all slots may already be in use by other extensions
+    if (slot < 0) return;
+
+    // functions are stored by their lowercase name
+    std::string name(_name);
+    zend_str_tolower(&name[0], name.size());
+
+    // find the function
+    auto *function = (zend_function *)zend_hash_str_find_ptr(table, name.data(), name.size());
+    if (function == nullptr || function->type != ZEND_INTERNAL_FUNCTION) return;
+
+    // store ourselves in the slot
+    function->internal_function.reserved[slot] = const_cast<Callable*>(this);
+
+    // from now on invoke() looks in the slot
+    _slot = slot;
 }
 
 /**
@@ -114,9 +200,8 @@ void Callable::initialize(zend_function_entry *entry, const char *classname, int
        _argv[_argc + 1].type = ZEND_TYPE_INIT_PTR(this, IS_PTR, true, 0);
 #endif
 
-        // we use our own invoke method, which does a lookup
-        // in the map we just installed ourselves in
-        entry->handler = &Callable::invoke;
+        // we use our own handler, which looks up the callable and calls it
+        entry->handler = _handler;
     }
 
     // fill the members of the entity, and hide a pointer to the current object in the name
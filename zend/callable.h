@@ -79,6 +79,7 @@ public:
      *  @param  that
      */
     Callable(const Callable &that) :
+        _handler(that._handler),
         _name(that._name),
         _return(that._return),
         _required(that._required),
@@ -92,6 +93,7 @@ public:
      *  @param  that
      */
     Callable(Callable &&that) :
+        _handler(that._handler),
         _name(std::move(that._name)),
         _return(that._return),
         _required(that._required),
@@ -131,7 +133,102 @@ public:
      */
     const std::string &name() const { return _name; }
 
+    /**
+     *  Store a pointer to this object in the function that was registered
+     *  by the Zend engine, so that calls can find it without a lookup
+     *  @param  table       Function table in which the function was registered
+     */
+    void install(HashTable *table) const;
+
 protected:
+    /**
+     *  Function that is called by the Zend engine for one specific type of
+     *  callback. The derived class passes a static function that calls the
+     *  callback directly, so that no virtual call is needed.
+     *  @param  execute_data
+     *  @param  return_value
+     */
+    template <typename T, Value (*callback)(T *callable, Parameters &params)>
+    static void invoke(INTERNAL_FUNCTION_PARAMETERS)
+    {
+        // find the callable
+        T *callable = static_cast<T*>(lookup(EX(func)));
+
+        // check if sufficient parameters were passed
+        if (!callable->sufficient(execute_data, return_value)) return;
+
+        // construct parameters
+        Parameters params(parameters(execute_data));
+
+        // the function could throw an exception
+        try
+        {
+            // call the callback, and pass on the result
+            yield(return_value, callback(callable, params));
+        }
+        catch (Throwable &throwable)
+        {
+            // an exception was not caught by the extension, let it bubble up
+            throwable.rethrow();
+        }
+    }
+
+    /**
+     *  The handler that the Zend engine calls (if there is no callback)
+     *  @var    ZendCallback
+     */
+    ZendCallback _handler = &Callable::invoke;
+
+    /**
+     *  Reserved slot of zend_internal_function in which the pointer to the
+     *  callable is stored, or -1 if no slot is used
+     *  @var    int
+     */
+    static int _slot;
+
+    /**
+     *  Find the callable that is hidden in the argument info of a function
+     *  @param  function    The function that is called
+     *  @return Callable
+     */
+    static Callable *find(const zend_function *function);
+
+    /**
+     *  Find the callable of the function that is called
+     *  @param  function    The function that is called
+     *  @return Callable
+     */
+    static Callable *lookup(const zend_function *function)
+    {
+        // the callable is normally stored in a reserved slot of the function
+        Callable *callable = _slot >= 0 ? reinterpret_cast<Callable*>(function->internal_function.reserved[_slot]) : nullptr;
+
+        // if that was not possible, it is hidden in the argument info
+        return callable ? callable : find(function);
+    }
+
+    /**
+     *  Check if sufficient parameters were passed, a warning is reported and
+     *  the return value is set to null if this is not the case
+     *  @param  execute_data
+     *  @param  return_value
+     *  @return bool
+     */
+    bool sufficient(zend_execute_data *execute_data, zval *return_value) const;
+
+    /**
+     *  The parameters that were passed to the function
+     *  @param  execute_data
+     *  @return Parameters
+     */
+    static Parameters parameters(zend_execute_data *execute_data);
+
+    /**
+     *  Pass the return value to the Zend engine
+     *  @param  return_value
+     *  @param  value
+     */
+    static void yield(zval *return_value, const Value &value);
 
     /**
      *  The callback to invoke
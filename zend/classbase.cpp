@@ -143,6 +143,11 @@ void ClassBase::implements(const ClassBase &interface) { _impl->implements(inter
  */
 void ClassBase::extends(const ClassBase &base) { _impl->extends(base._impl); }
 
+/**
+ *  Let clones share the C++ object until one of them is modified
+ */
+void ClassBase::copyOnWrite() { _impl->copyOnWrite(); }
+
 /**
  *  End namespace
  */
@@ -99,6 +99,9 @@ void ClassImpl::callMethod(INTERNAL_FUNCTION_PARAMETERS)
     const char *name = ZSTR_VAL(func->function_name);
     ClassBase *meta = data->self->_base;
 
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(data->self->_entry, Statistics::CallMethod);
+
     // the data structure was allocated by ourselves in the getMethod or
     // getStaticMethod functions, we no longer need it when the function falls
     // out of scope
@@ -143,6 +146,9 @@ void ClassImpl::callInvoke(INTERNAL_FUNCTION_PARAMETERS)
     // get self reference
     ClassBase *meta = data->self->_base;
 
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(data->self->_entry, Statistics::CallInvoke);
+
     // the data structure was allocated by ourselves in the getMethod or
     // getStaticMethod functions, we no longer need it when the function falls
     // out of scope
@@ -185,6 +191,9 @@ void ClassImpl::callInvoke(INTERNAL_FUNCTION_PARAMETERS)
  */
 zend_function *ClassImpl::getMethod(zend_object **object, zend_string *method, const zval *key)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(*object, Statistics::GetMethod);
+
     // something strange about the Zend engine (once more). The structure with
     // object-handlers has a get_method and call_method member. When a function is
     // called, the get_method function is called first, to retrieve information
@@ -391,6 +400,13 @@ zend_object_handlers *ClassImpl::objectHandlers()
     // handler to cast to a different type
     _handlers.cast_object = &ClassImpl::cast;
 
+    // functions to export the properties, only if they are overridden (the
+    // handler for var_dump() is available in all versions)
+#if PHP_VERSION_ID >= 70400
+    if (_base->exportable()) _handlers.get_properties_for = &ClassImpl::getPropertiesFor;
+#endif
+    if (_base->debuggable()) _handlers.get_debug_info = &ClassImpl::getDebugInfo;
+
     // method to compare two objects
 #if PHP_VERSION_ID < 80000
     _handlers.compare_objects = &ClassImpl::compare;
@@ -471,6 +487,106 @@ int ClassImpl::compare(zval *val1, zval *val2)
     }
 }
 
+#if PHP_VERSION_ID >= 70400
+/**
+ *  Function to export the properties of an object, this is called for array
+ *  casts, json_encode(), var_export() and the like
+ *  @param  object
+ *  @param  purpose
+ *  @return HashTable
+ */
+HashTable *ClassImpl::getPropertiesFor(ZEND_OBJECT_OR_ZVAL object, zend_prop_purpose purpose)
+{
+    // var_dump() is handled by the get_debug_info handler
+    if (purpose == ZEND_PROP_PURPOSE_DEBUG) return zend_std_get_properties_for(object, purpose);
+
+    // retrieve the class entry linked to this object
+#if PHP_VERSION_ID < 80000
+    auto *entry = Z_OBJCE_P(object);
+#else
+    auto *entry = object->ce;
+#endif
+    // we need the C++ class meta-information object
+    ClassImpl *impl = self(entry);
+
+    // the user function may throw an exception that needs to be processed
+    try
+    {
+        // the array to fill, sized for all properties in one go
+        Array result;
+        zend_hash_extend(Z_ARRVAL_P(result._val), impl->_properties.size() + impl->_members.size(), 0);
+
+        // let the object fill the array
+        impl->_base->callProperties(ObjectImpl::find(object)->object(), result);
+
+        // hand over the array
+        return toHashTable(std::move(result));
+    }
+    catch (const NotImplemented &exception)
+    {
+        // call default
+        return zend_std_get_properties_for(object, purpose);
+    }
+    catch (Throwable &throwable)
+    {
+        // object was not caught by the extension, let it end up in user space
+        throwable.rethrow();
+
+        // no properties
+        return nullptr;
+    }
+}
+#endif
+
+/**
+ *  Function to export the properties of an object for var_dump()
+ *  @param  object
+ *  @param  is_temp
+ *  @return HashTable
+ */
+HashTable *ClassImpl::getDebugInfo(ZEND_OBJECT_OR_ZVAL object, int *is_temp)
+{
+    // retrieve the class entry linked to this object
+#if PHP_VERSION_ID < 80000
+    auto *entry = Z_OBJCE_P(object);
+#else
+    auto *entry = object->ce;
+#endif
+    // we need the C++ class meta-information object
+    ClassImpl *impl = self(entry);
+
+    // the user function may throw an exception that needs to be processed
+    try
+    {
+        // the array to fill, sized for all properties in one go
+        Array result;
+        zend_hash_extend(Z_ARRVAL_P(result._val), impl->_properties.size() + impl->_members.size(), 0);
+
+        // let the object fill the array
+        impl->_base->callDebugInfo(ObjectImpl::find(object)->object(), result);
+
+        // the caller has to release the array
+        *is_temp = 1;
+
+        // hand over the array
+        return toHashTable(std::move(result));
+    }
+    catch (const NotImplemented &exception)
+    {
+        // call default
+        return std_object_handlers.get_debug_info(object, is_temp);
+    }
+    catch (Throwable &throwable)
+    {
+        // object was not caught by the extension, let it end up in user space
+        throwable.rethrow();
+
+        // no properties
+        *is_temp = 0;
+        return nullptr;
+    }
+}
+
 /**
  *  Function to cast the object to a different type
  *  @param  val
@@ -484,6 +600,9 @@ int ClassImpl::cast(ZEND_OBJECT_OR_ZVAL val, zval *retval, int type)
 zend_result ClassImpl::cast(ZEND_OBJECT_OR_ZVAL val, zval *retval, int type)
 #endif
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(val, Statistics::Cast);
+
     // get the base c++ object
     Base *object = ObjectImpl::find(val)->object();
 
@@ -547,6 +666,9 @@ zend_result ClassImpl::cast(ZEND_OBJECT_OR_ZVAL val, zval *retval, int type)
  */
 zend_object *ClassImpl::cloneObject(ZEND_OBJECT_OR_ZVAL val)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(val, Statistics::CloneObject);
+
     // retrieve the class entry linked to this object
 #if PHP_VERSION_ID < 80000
     auto *entry = Z_OBJCE_P(val);
@@ -560,6 +682,21 @@ zend_object *ClassImpl::cloneObject(ZEND_OBJECT_OR_ZVAL val)
     // retrieve the old object, which we are going to copy
     ObjectImpl *old_object = ObjectImpl::find(val);
 
+    // classes that are copied on write share the c++ object with the clone
+    if (impl->_copyOnWrite)
+    {
+        // the clone gets the same c++ object, the copy is made (and the magic
+        // c++ __clone method is called) when one of them is modified
+        auto *new_object = new ObjectImpl(entry, old_object, impl->objectHandlers(), 1);
+
+        // clone the members (this will also call the __clone() function if the user
+        // had registered that as a visible method)
+        zend_objects_clone_members(new_object->php(), old_object->php());
+
+        // done
+        return new_object->php();
+    }
+
     // create a new base c++ object
     auto *cpp = meta->clone(old_object->object());
 
@@ -584,6 +721,122 @@ zend_object *ClassImpl::cloneObject(ZEND_OBJECT_OR_ZVAL val)
     return new_object->php();
 }
 
+/**
+ *  Identifier of the statistics counters for the class of an object
+ *  @param  entry       Class entry of the object
+ *  @return size_t
+ */
+size_t ClassImpl::statistics(zend_class_entry *entry)
+{
+    // find the C++ class, and its counters
+    return self(entry)->_statistics;
+}
+
+/**
+ *  Does calling a function modify the object it is called on?
+ *  @param  function    The function that is called
+ *  @return bool
+ */
+bool ClassImpl::mutates(const zend_function *function)
+{
+    // calls that are handled by __call() and __invoke() could do anything
+    if (function->common.fn_flags & ZEND_ACC_CALL_VIA_HANDLER) return true;
+
+    // methods that are written in PHP can only modify the c++ object by calling a native method
+    if (function->type != ZEND_INTERNAL_FUNCTION) return false;
+
+    // the class that declared the function (this could also be a builtin
+    // class that a native class extends, which does not know the c++ object)
+    auto *scope = function->common.scope;
+    if (scope == nullptr || scope->info.user.doc_comment == nullptr || ZSTR_LEN(scope->info.user.doc_comment) > 0) return false;
+
+    // the method remembers whether it was flagged as mutating
+    return Method::mutates(function);
+}
+
+/**
+ *  Give an object that shares its C++ object with other instances a
+ *  private copy of the C++ object
+ *  @param  object      The object that is going to be modified
+ *  @return Base
+ */
+Base *ClassImpl::detach(ObjectImpl *object)
+{
+    // retrieve the class entry linked to this object
+    auto *entry = object->php()->ce;
+
+    // we need the C++ class meta-information object
+    ClassBase *meta = self(entry)->_base;
+
+    // is this the clone (in that case the copy has to be treated as a clone)
+    bool clone = object->clone();
+
+    // create a copy of the shared c++ object
+    auto *cpp = meta->clone(object->object());
+
+    // report error on failure (this does not occur because objects are only
+    // shared when the class is clonable)
+    if (!cpp) zend_error(E_ERROR, "Unable to clone %s", entry->name->val);
+
+    // from now on the object uses its private copy
+    auto *remaining = object->detach(cpp);
+
+    // the magic c++ __clone method was postponed until the copy was made
+    if (clone && !entry->clone) meta->callClone(cpp);
+
+    // nothing else to do if there are still other objects that share the c++ object
+    if (!remaining) return cpp;
+
+    // the object that is left with the shared c++ object takes it over
+    adopt(remaining);
+
+    // if the object that is left was already destructed, it was waiting for us
+    // to be destructed too, so the shared c++ object is destructed now
+    if (!remaining->destructed() || object->destructed()) return cpp;
+
+    // prevent exceptions
+    try
+    {
+        // call the destruct function
+        meta->callDestruct(remaining->object());
+    }
+    catch (const NotImplemented &exception)
+    {
+        // the default destructor was already called for the object
+    }
+
+    // done
+    return cpp;
+}
+
+/**
+ *  Let an object become the only owner of a C++ object that it shared
+ *  with other instances
+ *  @param  object      The object that is the only remaining owner
+ */
+void ClassImpl::adopt(ObjectImpl *object)
+{
+    // retrieve the class entry linked to this object
+    auto *entry = object->php()->ce;
+
+    // take over the c++ object, nothing else to do if the object is not a
+    // clone that still waits for the magic c++ __clone method
+    if (!object->adopt() || entry->clone) return;
+
+    // prevent exceptions (this is also called from the destructor of the
+    // object that was the last one to share the c++ object)
+    try
+    {
+        // call the postponed magic c++ __clone method
+        self(entry)->_base->callClone(object->object());
+    }
+    catch (Throwable &throwable)
+    {
+        // the exception was not caught by the extension, let it end up in user space
+        throwable.rethrow();
+    }
+}
+
 /**
  *  Function that is used to count the number of elements in the object
  *
@@ -600,6 +853,9 @@ int ClassImpl::countElements(ZEND_OBJECT_OR_ZVAL object, zend_long *count)
 zend_result ClassImpl::countElements(ZEND_OBJECT_OR_ZVAL object, zend_long *count)
 #endif
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(object, Statistics::CountElements);
+
     // does it implement the countable interface?
     Countable *countable = dynamic_cast<Countable*>(ObjectImpl::find(object)->object());
 
@@ -648,6 +904,9 @@ zend_result ClassImpl::countElements(ZEND_OBJECT_OR_ZVAL object, zend_long *coun
  */
 zval *ClassImpl::readDimension(ZEND_OBJECT_OR_ZVAL object, zval *offset, int type, zval *rv)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(object, Statistics::ReadDimension);
+
     // what to do with the type?
     //
     // the type parameter tells us whether the dimension was read in READ
@@ -710,8 +969,11 @@ zval *ClassImpl::readDimension(ZEND_OBJECT_OR_ZVAL object, zval *offset, int typ
  */
 void ClassImpl::writeDimension(ZEND_OBJECT_OR_ZVAL object, zval *offset, zval *value)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(object, Statistics::WriteDimension);
+
     // does it implement the arrayaccess interface?
-    ArrayAccess *arrayaccess = dynamic_cast<ArrayAccess*>(ObjectImpl::find(object)->object());
+    ArrayAccess *arrayaccess = dynamic_cast<ArrayAccess*>(ObjectImpl::find(object)->writable());
 
     // if it does not implement the ArrayAccess interface, we rely on the default implementation
     if (arrayaccess)
@@ -751,6 +1013,9 @@ void ClassImpl::writeDimension(ZEND_OBJECT_OR_ZVAL object, zval *offset, zval *v
  */
 int ClassImpl::hasDimension(ZEND_OBJECT_OR_ZVAL object, zval *member, int check_empty)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(object, Statistics::HasDimension);
+
     // does it implement the arrayaccess interface?
     ArrayAccess *arrayaccess = dynamic_cast<ArrayAccess*>(ObjectImpl::find(object)->object());
 
@@ -800,8 +1065,11 @@ int ClassImpl::hasDimension(ZEND_OBJECT_OR_ZVAL object, zval *member, int check_
  */
 void ClassImpl::unsetDimension(ZEND_OBJECT_OR_ZVAL object, zval *member)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(object, Statistics::UnsetDimension);
+
     // does it implement the arrayaccess interface?
-    ArrayAccess *arrayaccess = dynamic_cast<ArrayAccess*>(ObjectImpl::find(object)->object());
+    ArrayAccess *arrayaccess = dynamic_cast<ArrayAccess*>(ObjectImpl::find(object)->writable());
 
     // if it does not implement the ArrayAccess interface, we rely on the default implementation
     if (arrayaccess)
@@ -881,6 +1149,9 @@ zval *ClassImpl::toZval(Value &&value, int type, zval *rv)
  */
 zval *ClassImpl::readProperty(ZEND_OBJECT_OR_ZVAL object, ZEND_STRING_OR_ZVAL name, int type, void **cache_slot, zval *rv)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(object, Statistics::ReadProperty);
+
     // what to do with the type?
     //
     // the type parameter tells us whether the property was read in READ
@@ -952,6 +1223,29 @@ zval *ClassImpl::readProperty(ZEND_OBJECT_OR_ZVAL object, ZEND_STRING_OR_ZVAL na
     }
 }
 
+/**
+ *  Helper method to turn an array into a hash table that is handed over
+ *  to the Zend engine
+ *  @param  value   The array to convert
+ *  @return HashTable
+ */
+HashTable *ClassImpl::toHashTable(Array &&value)
+{
+    // the hash table inside the array
+    HashTable *result = Z_ARRVAL_P(value._val);
+
+    // the engine gets its own reference, so the hash table survives
+    // when the array object falls out of scope
+#if PHP_VERSION_ID < 70300
+    GC_REFCOUNT(result)++;
+#else
+    GC_ADDREF(result);
+#endif
+
+    // done
+    return result;
+}
+
 /**
  *  Function that is called when a property is set / updated
  *
@@ -966,8 +1260,11 @@ zval *ClassImpl::readProperty(ZEND_OBJECT_OR_ZVAL object, ZEND_STRING_OR_ZVAL na
  */
 PHP_WRITE_PROP_HANDLER_TYPE ClassImpl::writeProperty(ZEND_OBJECT_OR_ZVAL object, ZEND_STRING_OR_ZVAL name, zval *value, void **cache_slot)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(object, Statistics::WriteProperty);
+
     // retrieve the object and class
-    Base *base = ObjectImpl::find(object)->object();
+    Base *base = ObjectImpl::find(object)->writable();
 
     // retrieve the class entry linked to this object
 #if PHP_VERSION_ID < 80000
@@ -1063,6 +1360,9 @@ PHP_WRITE_PROP_HANDLER_TYPE ClassImpl::writeProperty(ZEND_OBJECT_OR_ZVAL object,
  */
 int ClassImpl::hasProperty(ZEND_OBJECT_OR_ZVAL object, ZEND_STRING_OR_ZVAL name, int has_set_exists, void **cache_slot)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(object, Statistics::HasProperty);
+
     // the default implementation throws an exception, if we catch that
     // we know for sure that the user has not overridden the __isset method
     try
@@ -1131,6 +1431,9 @@ int ClassImpl::hasProperty(ZEND_OBJECT_OR_ZVAL object, ZEND_STRING_OR_ZVAL name,
  */
 void ClassImpl::unsetProperty(ZEND_OBJECT_OR_ZVAL object, ZEND_STRING_OR_ZVAL member, void **cache_slot)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(object, Statistics::UnsetProperty);
+
     // the default implementation throws an exception, if we catch that
     // we know for sure that the user has not overridden the __unset method
     try
@@ -1151,7 +1454,7 @@ void ClassImpl::unsetProperty(ZEND_OBJECT_OR_ZVAL object, ZEND_STRING_OR_ZVAL me
         auto iter = impl->_properties.find(name);
 
         // if the property does not exist, we forward to the __unset
-        if (iter == impl->_properties.end()) impl->_base->callUnset(ObjectImpl::find(object)->object(), member);
+        if (iter == impl->_properties.end()) impl->_base->callUnset(ObjectImpl::find(object)->writable(), member);
 
         // callback properties cannot be unset
         zend_error(E_ERROR, "Property %s can not be unset", (const char *)name);
@@ -1178,12 +1481,21 @@ void ClassImpl::unsetProperty(ZEND_OBJECT_OR_ZVAL object, ZEND_STRING_OR_ZVAL me
  */
 void ClassImpl::destructObject(zend_object *object)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(object, Statistics::DestructObject);
+
     // find object
     ObjectImpl *obj = ObjectImpl::find(object);
 
     // get meta info
     ClassImpl *impl = self(object->ce);
 
+    // a c++ object that is shared with other instances is only destructed when
+    // the last of them is destructed (at shutdown all destructors run before
+    // any object is freed), the others only run the default destructor (for
+    // user space __destruct methods)
+    if (!obj->destructing()) return zend_objects_destroy_object(object);
+
     // prevent exceptions
     try
     {
@@ -1210,6 +1522,9 @@ void ClassImpl::destructObject(zend_object *object)
  */
 void ClassImpl::freeObject(zend_object *object)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(object, Statistics::FreeObject);
+
     // allocate memory for the object
     ObjectImpl *obj = ObjectImpl::find(object);
 
@@ -1225,6 +1540,9 @@ void ClassImpl::freeObject(zend_object *object)
  */
 zend_object *ClassImpl::createObject(zend_class_entry *entry)
 {
+    // measure the handler (if statistics are enabled)
+    Statistics::Scope scope(entry, Statistics::CreateObject);
+
     // we need the C++ class meta-information object
     ClassImpl *impl = self(entry);
 
@@ -1362,6 +1680,39 @@ int ClassImpl::unserialize(zval *object, zend_class_entry *entry, const unsigned
     return SUCCESS;
 }
 
+/**
+ *  Helper function to turn a method name into the key of the slots
+ *  @param  name        Name of the method
+ *  @return std::string
+ */
+static std::string lowercase(const char *name)
+{
+    // method names are case insensitive
+    std::string result(name);
+    zend_str_tolower(&result[0], result.size());
+
+    // done
+    return result;
+}
+
+/**
+ *  Add a method to the list of methods
+ *  @param  method      The method to add
+ *  @param  flags       Flags passed to the method() call
+ */
+void ClassImpl::add(std::shared_ptr<Method> &&method, int flags)
+{
+    // remember whether the method modifies the object (the flag itself is
+    // never passed on to the Zend engine)
+    if (flags & Mutating) method->mutating();
+
+    // the method gets the next slot
+    _slots[lowercase(method->name().c_str())] = _methods.size();
+
+    // store the method
+    _methods.push_back(std::move(method));
+}
+
 /**
  *  Helper method to check if a function is registered for this instance
  *  @param name         name of the function to check for
@@ -1369,10 +1720,8 @@ int ClassImpl::unserialize(zval *object, zend_class_entry *entry, const unsigned
  */
 bool ClassImpl::hasMethod(const char* name) const
 {
-    // find the method
-    auto result = std::find_if(_methods.begin(), _methods.end(), [name](std::shared_ptr<Method> method){ return method->name() == name; });
-    // return wether its found or not
-    return result != _methods.end();
+    // look up the slot of the method
+    return _slots.find(lowercase(name)) != _slots.end();
 }
 
 /**
@@ -1412,6 +1761,9 @@ const struct _zend_function_entry *ClassImpl::entries()
     // allocate memory for the functions
     _entries = new zend_function_entry[entrycount + 1];
 
+    // the methods in the same order as the entries
+    _registered.reserve(entrycount);
+
     // keep iterator counter
     int i = 0;
 
@@ -1423,6 +1775,9 @@ const struct _zend_function_entry *ClassImpl::entries()
 
         // let the function fill the entry
         method->initialize(entry, _name);
+
+        // remember which method belongs to the entry
+        _registered.push_back(method.get());
     }
 
     // if the class is countable, we might need to add some extra methods
@@ -1433,7 +1788,7 @@ const struct _zend_function_entry *ClassImpl::entries()
         static Method count("count", &Base::__count, 0, {});
 
         // register the serialize and unserialize method in case this was not yet done in PHP user space
-        if (!hasMethod("count")) count.initialize(&_entries[i++], _name);
+        if (!hasMethod("count")) { count.initialize(&_entries[i++], _name); _registered.push_back(&count); }
     }
 
     // if the class is serializable, we might need some extra methods
@@ -1445,8 +1800,8 @@ const struct _zend_function_entry *ClassImpl::entries()
         static Method unserialize("unserialize", &Base::__unserialize, 0, { ByVal("input", Type::Undefined, true) });
 
         // register the serialize and unserialize method in case this was not yet done in PHP user space
-        if (!hasMethod("serialize")) serialize.initialize(&_entries[i++], _name);
-        if (!hasMethod("unserialize")) unserialize.initialize(&_entries[i++], _name);
+        if (!hasMethod("serialize")) { serialize.initialize(&_entries[i++], _name); _registered.push_back(&serialize); }
+        if (!hasMethod("unserialize")) { unserialize.initialize(&_entries[i++], _name); _registered.push_back(&unserialize); }
     }
     
     // if the class is traverable, we might need extra methods too (especially on php 8.1, maybe also 8.0?)
@@ -1457,7 +1812,7 @@ const struct _zend_function_entry *ClassImpl::entries()
         static Method getIterator("getIterator", &Base::__getIterator, 0, {});
 
         // register the serialize and unserialize method in case this was not yet done in PHP user space
-        if (!hasMethod("getIterator")) getIterator.initialize(&_entries[i++], _name);
+        if (!hasMethod("getIterator")) { getIterator.initialize(&_entries[i++], _name); _registered.push_back(&getIterator); }
     }
 
     // last entry should be set to all zeros
@@ -1494,6 +1849,9 @@ zend_class_entry *ClassImpl::initialize(ClassBase *base, const std::string &pref
     // update the name
     if (prefix.size() > 0) _name = prefix + "\\" + _name;
 
+    // register the class for the handler statistics
+    _statistics = Statistics::add(_name);
+
     // initialize the class entry
     INIT_CLASS_ENTRY_EX(entry, _name.c_str(), _name.size(), entries());
 
@@ -1553,6 +1911,10 @@ zend_class_entry *ClassImpl::initialize(ClassBase *base, const std::string &pref
         _entry = zend_register_internal_class(&entry);
     }
 
+    // link the methods to the registered functions, so that calls do not
+    // have to find the method based on the argument info
+    for (auto *method : _registered) method->install(&_entry->function_table);
+
     // register the interfaces
     for (auto &interface : _interfaces)
     {
@@ -25,6 +25,12 @@ namespace Php {
 # define ZEND_OBJECT_OR_ZVAL zend_object *
 # define ZEND_STRING_OR_ZVAL zend_string *
 #endif
+
+/**
+ *  Forward declarations
+ */
+class ObjectImpl;
+
 /**
  *  Class definition
  */
@@ -62,10 +68,23 @@ private:
     zend_function_entry *_entries = nullptr;
 
     /**
-     *  All class methods
-     *  @var    std::list
+     *  All class methods, the index in the vector is the slot of the method
+     *  @var    std::vector
+     */
+    std::vector<std::shared_ptr<Method>> _methods;
+
+    /**
+     *  Slots of the methods, indexed by lowercase method name
+     *  @var    std::unordered_map
+     */
+    std::unordered_map<std::string, size_t> _slots;
+
+    /**
+     *  The methods in the same order as the function entries, these are
+     *  linked to the registered functions after the class is registered
+     *  @var    std::vector
      */
-    std::list<std::shared_ptr<Method>> _methods;
+    std::vector<const Method*> _registered;
 
     /**
      *  All class members (class properties)
@@ -109,6 +128,18 @@ private:
      */
     zend_string *_self = nullptr;
 
+    /**
+     *  Do clones share the C++ object until one of them is modified?
+     *  @var    bool
+     */
+    bool _copyOnWrite = false;
+
+    /**
+     *  Identifier of the statistics counters of this class
+     *  @var    size_t
+     */
+    size_t _statistics = 0;
+
     /**
      *  Retrieve an array of zend_function_entry objects that hold the
      *  properties for each method. This method is called at extension
@@ -118,6 +149,13 @@ private:
      */
     const zend_function_entry *entries();
 
+    /**
+     *  Add a method to the list of methods
+     *  @param  method      The method to add
+     *  @param  flags       Flags passed to the method() call
+     */
+    void add(std::shared_ptr<Method> &&method, int flags = 0);
+
     /**
      *  Helper method to check if a function is registered for this instance
      *  @param name         name of the function to check for
@@ -135,6 +173,15 @@ private:
      */
     static zval *toZval(Value &&value, int type, zval *rv);
 
+    /**
+     *  Helper method to turn an array into a hash table that is handed
+     *  over to the Zend engine (which is responsible for releasing it)
+     *
+     *  @param  value   The array to convert
+     *  @return HashTable
+     */
+    static HashTable *toHashTable(Array &&value);
+
 public:
     /**
      *  Constructor
@@ -360,6 +407,18 @@ public:
      */
     static int compare(zval *object1, zval *object2);
 
+    /**
+     *  Functions to export the properties of an object
+     *  @param  object
+     *  @param  purpose
+     *  @param  is_temp
+     *  @return HashTable
+     */
+#if PHP_VERSION_ID >= 70400
+    static HashTable *getPropertiesFor(ZEND_OBJECT_OR_ZVAL object, zend_prop_purpose purpose);
+#endif
+    static HashTable *getDebugInfo(ZEND_OBJECT_OR_ZVAL object, int *is_temp);
+
     /**
      *  Methods that are called to serialize/unserialize an object
      *  @param  object      The object to be serialized
@@ -387,7 +446,7 @@ public:
      *  @param  flags       Optional flags
      *  @param  args        Description of the supported arguments
      */
-    void method(const char *name, ZendCallback callback, int flags = 0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, callback, flags & MethodModifiers, args)); }
+    void method(const char *name, ZendCallback callback, int flags = 0, const Arguments &args = {}) { add(std::make_shared<Method>(name, callback, flags & MethodModifiers, args), flags); }
 
     /**
      *  Add a method to the class
@@ -404,14 +463,14 @@ public:
      *  @param  flags       Optional flags
      *  @param  args        Description of the supported arguments
      */
-    void method(const char *name, const method_callback_0 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, flags & MethodModifiers, args)); }
-    void method(const char *name, const method_callback_1 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, flags & MethodModifiers, args)); }
-    void method(const char *name, const method_callback_2 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, flags & MethodModifiers, args)); }
-    void method(const char *name, const method_callback_3 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, flags & MethodModifiers, args)); }
-    void method(const char *name, const method_callback_4 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, flags & MethodModifiers, args)); }
-    void method(const char *name, const method_callback_5 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, flags & MethodModifiers, args)); }
-    void method(const char *name, const method_callback_6 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, flags & MethodModifiers, args)); }
-    void method(const char *name, const method_callback_7 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, flags & MethodModifiers, args)); }
+    void method(const char *name, const method_callback_0 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, flags & MethodModifiers, args), flags); }
+    void method(const char *name, const method_callback_1 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, flags & MethodModifiers, args), flags); }
+    void method(const char *name, const method_callback_2 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, flags & MethodModifiers, args), flags); }
+    void method(const char *name, const method_callback_3 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, flags & MethodModifiers, args), flags); }
+    void method(const char *name, const method_callback_4 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, flags & MethodModifiers, args), flags); }
+    void method(const char *name, const method_callback_5 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, flags & MethodModifiers, args), flags); }
+    void method(const char *name, const method_callback_6 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, flags & MethodModifiers, args), flags); }
+    void method(const char *name, const method_callback_7 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, flags & MethodModifiers, args), flags); }
 
     /**
      *  Add a static method to the class
@@ -425,10 +484,10 @@ public:
      *  @param  flags       Optional flags
      *  @param  args        Description of the supported arguments
      */
-    void method(const char *name, const native_callback_0 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, (flags & MethodModifiers) | Static, args)); }
-    void method(const char *name, const native_callback_1 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, (flags & MethodModifiers) | Static, args)); }
-    void method(const char *name, const native_callback_2 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, (flags & MethodModifiers) | Static, args)); }
-    void method(const char *name, const native_callback_3 &method, int flags=0, const Arguments &args = {}) { _methods.push_back(std::make_shared<Method>(name, method, (flags & MethodModifiers) | Static, args)); }
+    void method(const char *name, const native_callback_0 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, (flags & MethodModifiers) | Static, args)); }
+    void method(const char *name, const native_callback_1 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, (flags & MethodModifiers) | Static, args)); }
+    void method(const char *name, const native_callback_2 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, (flags & MethodModifiers) | Static, args)); }
+    void method(const char *name, const native_callback_3 &method, int flags=0, const Arguments &args = {}) { add(std::make_shared<Method>(name, method, (flags & MethodModifiers) | Static, args)); }
 
     /**
      *  Add an abstract method to the class
@@ -444,7 +503,7 @@ public:
         // expect that we could even force adding "Abstract" here, because we're adding an abstract method -- but
         // in a PHP interface the "Abstract" modifier is not allowed - even though it is of course abstract.
         // So we only _allow_ abstract here, and expect the caller to _set_ it.
-        _methods.push_back(std::make_shared<Method>(name, (flags & (MethodModifiers | Static | Abstract)), args));
+        add(std::make_shared<Method>(name, (flags & (MethodModifiers | Static | Abstract)), args));
     }
 
     /**
@@ -495,6 +554,45 @@ public:
      */
     void extends(const std::shared_ptr<ClassImpl> &base) { _parent = base; }
 
+    /**
+     *  Let clones share the C++ object until one of them is modified
+     */
+    void copyOnWrite() { _copyOnWrite = true; }
+
+    /**
+     *  Identifier of the statistics counters for the class of an object
+     *  @param  entry       Class entry of the object
+     *  @return size_t
+     */
+    static size_t statistics(zend_class_entry *entry);
+
+    /**
+     *  Does calling a function modify the object it is called on? This is
+     *  the case for methods that were registered with the Php::Mutating flag,
+     *  and for calls that are handled by __call() or __invoke()
+     *
+     *  @param  function    The function that is called
+     *  @return bool
+     */
+    static bool mutates(const zend_function *function);
+
+    /**
+     *  Give an object that shares its C++ object with other instances a
+     *  private copy of the C++ object, because it is about to be modified
+     *
+     *  @param  object      The object that is going to be modified
+     *  @return Base        The private copy
+     */
+    static Base *detach(ObjectImpl *object);
+
+    /**
+     *  Let an object become the only owner of a C++ object that it shared
+     *  with other instances, the postponed magic __clone method is called
+     *  if the object is a clone
+     *
+     *  @param  object      The object that is the only remaining owner
+     */
+    static void adopt(ObjectImpl *object);
 };
 
 /**
@@ -0,0 +1,84 @@
+/**
+ *  ClassRef.cpp
+ *
+ *  Implementation file for the ClassRef class
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+#include "string.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Constructor
+ *  @param  name        Name of the class
+ *  @param  size        Size of the name
+ */
+ClassRef::ClassRef(const char *name, size_t size)
+{
+    // starting slashes can be ignored
+    if (size > 0 && name[0] == '\\') { name++; size--; }
+
+    // store the name
+    _name.assign(name, size);
+
+    // create the key, it is used in every request
+    _key = zend_string_init(name, size, 1);
+
+    // the class table uses lowercase names
+    zend_str_tolower(ZSTR_VAL(_key), ZSTR_LEN(_key));
+
+    // calculate the hash right away, so that lookups do not have to do that
+    zend_string_hash_val(_key);
+}
+
+/**
+ *  Destructor
+ */
+ClassRef::~ClassRef()
+{
+    // release the key
+    zend_string_release(_key);
+}
+
+/**
+ *  The class entry (nullptr if the class does not exist)
+ *  @param  autoload    Should the autoloader be called for unknown classes?
+ *  @return zend_class_entry
+ */
+zend_class_entry *ClassRef::entry(bool autoload) const
+{
+    // the current request
+    auto request = ConstantCache::current();
+
+    // was the class already found in this request?
+    if (request != 0 && _request == request) return _entry;
+
+    // look in the class table first, this does not have to allocate a lowercase name
+    auto *value = zend_hash_find(EG(class_table), _key);
+
+    // the class entry (class aliases are stored as pointers too)
+    auto *entry = value ? (zend_class_entry *)Z_PTR_P(value) : nullptr;
+
+    // unknown classes may have to be autoloaded
+    if (!entry && autoload) entry = zend_lookup_class(String{ _name });
+
+    // classes that do not exist may still be declared later
+    if (entry == nullptr || request == 0) return entry;
+
+    // remember the class for the rest of the request
+    _entry = entry;
+    _request = request;
+
+    // done
+    return entry;
+}
+
+/**
+ *  End namespace
+ */
+}
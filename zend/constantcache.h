@@ -0,0 +1,68 @@
+/**
+ *  ConstantCache.h
+ *
+ *  Keeps track of the requests in which Php::ConstantRef and Php::ClassRef
+ *  objects may use the constants and classes that they looked up earlier.
+ *  Constants that are defined by scripts, and classes that are declared by
+ *  scripts, are destructed at the end of the request, so the remembered
+ *  values may only be used in the request in which they were looked up.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class ConstantCache
+{
+private:
+    /**
+     *  Number of the current request (zero when no request is running)
+     *  @var    uint64_t
+     */
+    static thread_local uint64_t _current;
+
+    /**
+     *  Number of requests that were started
+     *  @var    uint64_t
+     */
+    static thread_local uint64_t _requests;
+
+public:
+    /**
+     *  Number of the current request, constants may only be remembered
+     *  when this is not zero
+     *  @return uint64_t
+     */
+    static uint64_t current()
+    {
+#ifdef ZTS
+        // handles are shared between threads, so nothing is remembered
+        return 0;
+#else
+        // the current request
+        return _current;
+#endif
+    }
+
+    /**
+     *  Called when a new request starts
+     */
+    static void start() { _current = ++_requests; }
+
+    /**
+     *  Called when the request ends, constants that are looked up after
+     *  this are not remembered, because they are about to be destructed
+     */
+    static void stop() { _current = 0; }
+};
+
+/**
+ *  End namespace
+ */
+}
@@ -37,8 +37,8 @@ Value constant(const char *name)
  */
 Value constant(const char *constant, size_t size)
 {
-    // retrieve the constant
-    auto *result = zend_get_constant(String{ constant, size });
+    // names without a class can be looked up without constructing a string
+    auto *result = memchr(constant, ':', size) ? zend_get_constant(String{ constant, size }) : zend_get_constant_str(constant, size);
 
     // did the constant exist?
     if (!result) return nullptr;
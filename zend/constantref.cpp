@@ -0,0 +1,68 @@
+/**
+ *  ConstantRef.cpp
+ *
+ *  Implementation file for the ConstantRef class
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+#include "string.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Number of the current request, and the number of requests
+ *  @var    uint64_t
+ */
+thread_local uint64_t ConstantCache::_current = 0;
+thread_local uint64_t ConstantCache::_requests = 0;
+
+/**
+ *  Find the value of the constant
+ *  @return zval
+ */
+zval *ConstantRef::lookup() const
+{
+    // the current request
+    auto request = ConstantCache::current();
+
+    // was the constant already found in this request?
+    if (request != 0 && _request == request) return _value;
+
+    // look up the constant
+    auto *value = zend_get_constant_ex(String{ _name }, nullptr, ZEND_FETCH_CLASS_SILENT);
+
+    // constants that do not exist may still be defined later
+    if (value == nullptr || request == 0) return value;
+
+    // remember the constant for the rest of the request
+    _value = value;
+    _request = request;
+
+    // done
+    return value;
+}
+
+/**
+ *  The value of the constant (null if it does not exist)
+ *  @return Value
+ */
+Value ConstantRef::value() const
+{
+    // find the constant
+    auto *value = lookup();
+
+    // did the constant exist?
+    if (!value) return nullptr;
+
+    // return the valid result
+    return value;
+}
+
+/**
+ *  End namespace
+ */
+}
@@ -0,0 +1,176 @@
+/**
+ *  ErrorLimiter.cpp
+ *
+ *  Implementation file for the limiter of reported messages
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  The clock that is used for refilling the buckets
+ */
+using Clock = std::chrono::steady_clock;
+
+/**
+ *  A group of messages that come from the same place
+ */
+struct ErrorSite
+{
+    /**
+     *  Number of messages that may still be reported
+     *  @var    double
+     */
+    double tokens;
+
+    /**
+     *  Time when the tokens were last updated
+     *  @var    Clock::time_point
+     */
+    Clock::time_point updated;
+
+    /**
+     *  Number of messages that were suppressed
+     *  @var    size_t
+     */
+    size_t suppressed = 0;
+};
+
+/**
+ *  The limiter of a single thread
+ */
+class ThreadErrors
+{
+public:
+    /**
+     *  Number of messages that are reported before limiting starts (0 when disabled)
+     *  @var    size_t
+     */
+    size_t burst = 0;
+
+    /**
+     *  Number of messages per second that are reported after that
+     *  @var    double
+     */
+    double rate = 0.0;
+
+    /**
+     *  The groups of messages, indexed by type, file and line (the name of
+     *  the file is copied, because the name of eval()'d code is freed when
+     *  the code is destructed, and its memory can be reused for another file)
+     *  @var    std::map
+     */
+    std::map<std::tuple<int, std::string, uint32_t>, ErrorSite> sites;
+};
+
+/**
+ *  The limiter of this thread
+ *  @var    ThreadErrors
+ */
+static thread_local ThreadErrors limiter;
+
+/**
+ *  Should a message be reported?
+ *  @param  type        The type of message (E_WARNING, E_NOTICE, et cetera)
+ *  @return bool
+ */
+bool ErrorLimiter::allow(int type)
+{
+    // is limiting turned off, or is this an error that ends the script?
+    if (limiter.burst == 0 || (type & E_FATAL_ERRORS)) return true;
+
+    // the place in the script from which the extension was called
+    bool executing = zend_is_executing();
+    const char *file = executing ? zend_get_executed_filename() : "";
+    uint32_t line = executing ? zend_get_executed_lineno() : 0;
+
+    // the current time
+    auto now = Clock::now();
+
+    // the key of the group
+    auto key = std::make_tuple(type, std::string(file), line);
+
+    // find the group of this message
+    auto iter = limiter.sites.find(key);
+
+    // is this the first message from this place?
+    if (iter == limiter.sites.end())
+    {
+        // create the group
+        auto &site = limiter.sites[std::move(key)];
+
+        // use the first token
+        site.tokens = limiter.burst - 1;
+        site.updated = now;
+
+        // report the message
+        return true;
+    }
+
+    // the group of messages
+    auto &site = iter->second;
+
+    // add the tokens that were earned since the last update
+    site.tokens = std::min(site.tokens + std::chrono::duration<double>(now - site.updated).count() * limiter.rate, (double)limiter.burst);
+    site.updated = now;
+
+    // is there a token left?
+    if (site.tokens >= 1.0) return site.tokens -= 1.0, true;
+
+    // the message is suppressed
+    site.suppressed += 1;
+
+    // done
+    return false;
+}
+
+/**
+ *  Start limiting messages for a new request
+ *  @param  burst       Number of messages that are reported before limiting starts (0 to disable)
+ *  @param  rate        Number of messages per second that are reported after that
+ */
+void ErrorLimiter::start(size_t burst, double rate)
+{
+    // set the options
+    limiter.burst = burst;
+    limiter.rate = rate;
+}
+
+/**
+ *  Report the suppressed messages at the end of the request
+ */
+void ErrorLimiter::stop()
+{
+    // the groups are taken out, so that the summaries are not limited themselves
+    auto sites = std::move(limiter.sites);
+
+    // no groups are kept for the next request
+    limiter.sites.clear();
+    limiter.burst = 0;
+
+    // report the groups that had messages suppressed
+    for (const auto &site : sites)
+    {
+        // were messages suppressed?
+        if (site.second.suppressed == 0) continue;
+
+        // the type of the messages, and the place in the script
+        int type = std::get<0>(site.first);
+        const auto &file = std::get<1>(site.first);
+        uint32_t line = std::get<2>(site.first);
+
+        // report the number of messages, with the place if there is one
+        if (file.empty()) zend_error(type, "%zu similar messages were suppressed", site.second.suppressed);
+        else zend_error(type, "%zu similar messages from %s on line %u were suppressed", site.second.suppressed, file.c_str(), line);
+    }
+}
+
+/**
+ *  End namespace
+ */
+}
@@ -0,0 +1,52 @@
+/**
+ *  ErrorLimiter.h
+ *
+ *  Limits the number of messages that are reported via the Php::warning,
+ *  Php::notice and Php::deprecated streams. Messages are grouped by the
+ *  place in the PHP script from which the extension was called (file and
+ *  line number) and by their type, and every group gets a token bucket:
+ *  the first "phpcpp.error_burst" messages of a group are reported, after
+ *  that "phpcpp.error_rate" messages per second. The number of suppressed
+ *  messages is reported at the end of the request. Limiting is turned off
+ *  when "phpcpp.error_burst" is zero (the default).
+ *
+ *  Php::error is not limited, because errors end the script anyway.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class ErrorLimiter
+{
+public:
+    /**
+     *  Should a message be reported?
+     *  @param  type        The type of message (E_WARNING, E_NOTICE, et cetera)
+     *  @return bool
+     */
+    static bool allow(int type);
+
+    /**
+     *  Start limiting messages for a new request
+     *  @param  burst       Number of messages that are reported before limiting starts (0 to disable)
+     *  @param  rate        Number of messages per second that are reported after that
+     */
+    static void start(size_t burst, double rate);
+
+    /**
+     *  Report the suppressed messages at the end of the request
+     */
+    static void stop();
+};
+
+/**
+ *  End namespace
+ */
+}
@@ -61,6 +61,24 @@ bool class_exists(const char *classname, size_t len, bool autoload)
     }
 }
 
+/**
+ *  Check whether a class that is referred to by a handle exists
+ *  @param  classref
+ *  @param  autoload
+ *  @return bool
+ */
+bool class_exists(const ClassRef &classref, bool autoload)
+{
+    // retrieve class entry
+    auto *ce = classref.entry(autoload);
+
+    // no such class
+    if (!ce) return false;
+
+    // the found "class" could also be an interface or trait, which we do no want
+    return (ce->ce_flags & (ZEND_ACC_INTERFACE | (ZEND_ACC_TRAIT - ZEND_ACC_EXPLICIT_ABSTRACT_CLASS))) == 0;
+}
+
 /**
  *  End of namespace
  */
@@ -156,6 +156,17 @@ void Extension::iniVariables(const std::function<void(Ini &ini)> &callback)
     _impl->iniVariables(callback);
 }
 
+/**
+ *  Register the module globals
+ *  @param  globals     The globals to register (ownership is taken)
+ *  @return ModuleGlobalsBase
+ */
+ModuleGlobalsBase *Extension::install(ModuleGlobalsBase *globals)
+{
+    // pass on to the implementation
+    return _impl->globals(globals);
+}
+
 /**
  *  End of namespace
  */
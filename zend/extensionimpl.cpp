@@ -101,6 +101,62 @@ static ExtensionImpl *find(int number)
     return iter->second;
 }
 
+/**
+ *  Register a static table of constants
+ *  @param  prefix          Namespace prefix
+ *  @param  entries         The constants
+ *  @param  count           Number of constants
+ *  @param  module_number   The module number
+ */
+static void register_constants(const std::string &prefix, const ConstantEntry *entries, size_t count, int module_number)
+{
+    // the constant structure from the zend engine (the engine makes a copy)
+    zend_constant constant;
+
+    // the namespace part of the names is the same for all constants
+    size_t skip = prefix.empty() ? 0 : prefix.size() + 1;
+
+    // loop through the constants
+    for (size_t i = 0; i < count; ++i)
+    {
+        // the constant to register
+        const auto &entry = entries[i];
+
+        // construct the full name
+        auto *name = zend_string_alloc(skip + entry.size(), 1);
+        if (skip > 0) memcpy(ZSTR_VAL(name), prefix.data(), prefix.size());
+        if (skip > 0) ZSTR_VAL(name)[prefix.size()] = '\\';
+        memcpy(ZSTR_VAL(name) + skip, entry.name(), entry.size());
+        ZSTR_VAL(name)[skip + entry.size()] = '\0';
+
+        // the name is interned, so that its hash is calculated only once and it is never copied
+        constant.name = zend_new_interned_string(name);
+
+        // check the type
+        switch (entry.type()) {
+        case Type::False:   ZVAL_FALSE(&constant.value); break;
+        case Type::True:    ZVAL_TRUE(&constant.value); break;
+        case Type::Numeric: ZVAL_LONG(&constant.value, entry.numeric()); break;
+        case Type::Float:   ZVAL_DOUBLE(&constant.value, entry.floating()); break;
+        case Type::String:  ZVAL_INTERNED_STR(&constant.value, zend_new_interned_string(zend_string_init(entry.string(), entry.length(), 1))); break;
+        default:            ZVAL_NULL(&constant.value); break;
+        }
+
+        // before 7.3 constants could simply be set
+#if PHP_VERSION_ID < 70300
+        // set all the other constant properties
+        constant.flags = CONST_CS | CONST_PERSISTENT;
+        constant.module_number = module_number;
+#else
+        // from 7.3 onwards there is a macro for setting the constant flags and module number
+        ZEND_CONSTANT_SET_FLAGS(&constant, CONST_CS | CONST_PERSISTENT, module_number);
+#endif
+
+        // register the constant
+        zend_register_constant(&constant);
+    }
+}
+
 /**
  *  Function that is called when the extension initializes
  *  @param  type        Module type
@@ -151,7 +207,29 @@ ZEND_RESULT_OR_INT ExtensionImpl::processRequest(int type, int module_number)
 {
     // get the extension
     auto *extension = find(module_number);
-    
+
+    // settings of the library that apply to this request
+    if (extension->_shared)
+    {
+        // check if the handler statistics should be counted during this request
+        Statistics::enabled = INI_INT("phpcpp.stats") > 0;
+
+        // persistent scripts must allocate a new runtime cache
+        PersistentOpcodes::start();
+
+        // constants that were looked up in an earlier request are no longer valid
+        ConstantCache::start();
+
+        // set the size of the cache of compiled scripts
+        ScriptCache::start(std::max(INI_INT("phpcpp.eval_cache"), (zend_long)0), std::max(INI_INT("phpcpp.eval_cache_size"), (zend_long)0));
+
+        // enable the cache of resolved and compiled files
+        FileCache::start(INI_INT("phpcpp.file_cache") > 0, std::max(INI_INT("phpcpp.file_cache_ttl"), (zend_long)0));
+
+        // limit the number of warnings and notices that are reported from the same place
+        ErrorLimiter::start(std::max(INI_INT("phpcpp.error_burst"), (zend_long)0), std::max(INI_FLT("phpcpp.error_rate"), 0.0));
+    }
+
     // is the callback registered?
     if (extension->_onRequest) extension->_onRequest();
     
@@ -172,6 +250,32 @@ ZEND_RESULT_OR_INT ExtensionImpl::processIdle(int type, int module_number)
     
     // is the callback registered?
     if (extension->_onIdle) extension->_onIdle();
+
+    // module globals that are reset per request are constructed again
+    if (extension->_globals && extension->_globals->_reset)
+    {
+        // the struct of this process or thread
+        auto *globals = extension->_globals.get();
+        auto *data = globals->pointer();
+
+        // construct it from scratch
+        globals->_destruct(data);
+        globals->_construct(data);
+    }
+
+    // output that is still buffered should not end up in the next request
+    if (extension->_shared) out.flush();
+
+    // write the handler statistics to the log, if requested
+    if (extension->_shared && INI_INT("phpcpp.stats") > 1) Statistics::log();
+
+    // the compiled scripts live on the request heap, so they are removed now
+    if (extension->_shared) ScriptCache::stop();
+    if (extension->_shared) FileCache::stop();
+    if (extension->_shared) ConstantCache::stop();
+
+    // report how many messages were suppressed
+    if (extension->_shared) ErrorLimiter::stop();
     
     // done
     return SUCCESS;
@@ -299,8 +403,11 @@ zend_module_entry *ExtensionImpl::module()
     // and nothing should be initialized
     if (_entry.module_startup_func == &ExtensionImpl::processMismatch) return &_entry;
 
-    // the number of functions
-    int count = _data->functions();
+    // the first extension also exposes the shared functions and settings of the library
+    _shared = _shared || Statistics::claim();
+
+    // the number of functions (plus the phpcpp_stats() function)
+    int count = _data->functions() + (_shared ? 1 : 0);
     
     // skip if there are no functions
     if (count == 0) return &_entry;
@@ -311,15 +418,30 @@ zend_module_entry *ExtensionImpl::module()
     // index being processed
     int i = 0;
 
-    // apply a function to each function
-    _data->functions([&i, entries](const std::string &prefix, NativeFunction &function) {
-        
+    // fill an entry for each function (the names are already fully qualified)
+    for (auto &function : _data->_functions) function->initialize(&entries[i++]);
+
+    // add the shared function and settings
+    if (_shared)
+    {
         // initialize the function
-        function.initialize(prefix, &entries[i]);
-        
-        // move on to the next iteration
-        i++;
-    });
+        Statistics::function().initialize(&entries[i++]);
+
+        // counting is disabled by default
+        _ini_entries.push_back(std::make_shared<Ini>("phpcpp.stats", "0"));
+
+        // the size of the cache of compiled scripts (number of scripts and bytes of source code)
+        _ini_entries.push_back(std::make_shared<Ini>("phpcpp.eval_cache", "64"));
+        _ini_entries.push_back(std::make_shared<Ini>("phpcpp.eval_cache_size", "1048576"));
+
+        // the cache of resolved and compiled files is off by default (it changes the include semantics), and for how many seconds absolute paths are kept across requests
+        _ini_entries.push_back(std::make_shared<Ini>("phpcpp.file_cache", "0"));
+        _ini_entries.push_back(std::make_shared<Ini>("phpcpp.file_cache_ttl", "0"));
+
+        // the number of messages from the same place that are reported before limiting starts (0 for no limit), and the rate after that
+        _ini_entries.push_back(std::make_shared<Ini>("phpcpp.error_burst", "0"));
+        _ini_entries.push_back(std::make_shared<Ini>("phpcpp.error_rate", "1"));
+    }
 
     // last entry should be set to all zeros
     zend_function_entry *last = &entries[count];
@@ -367,22 +489,26 @@ bool ExtensionImpl::initialize(int module_number)
     zend_register_ini_entries(_ini.get(), module_number);
 
     // the constants are registered after the module is ready
-    _data->constants([module_number](const std::string &prefix, Constant &c) {
-        
-        // forward to implementation class
-        c.implementation()->initialize(prefix, module_number);
-    });
-    
-    // we also need to register each class, find out all classes
-    _data->classes([](const std::string &prefix, ClassBase &c) {
-        
-        // forward to implementation class
-        c.implementation()->initialize(&c, prefix);
-    });
+    for (auto &constant : _data->_constants) constant.second->implementation()->initialize(constant.first, module_number);
+
+    // and the static tables of constants
+    for (auto &table : _data->_tables) register_constants(table.prefix, table.entries, table.count, module_number);
+
+    // link the functions to the functions registered by the Zend engine
+    for (auto &function : _data->_functions) function->install(CG(function_table));
+
+    // the same for the phpcpp_stats() function
+    if (_shared) Statistics::function().install(CG(function_table));
+
+    // we also need to register each class
+    for (auto &c : _data->_classes) c.second->implementation()->initialize(c.second.get(), c.first);
 
     // initialize the PhpCpp::Functor class
     Functor::initialize();
 
+    // the first extension also exposes the PhpCpp\MappedFile class
+    if (_shared) MappedFile::initialize();
+
     // remember that we're initialized (when you use "apache reload" it is 
     // possible that the processStartup() method is called more than once)
     _locked = true;
@@ -413,6 +539,9 @@ bool ExtensionImpl::shutdown(int module_number)
     // shutdown the functor class
     Functor::shutdown();
 
+    // and the mapped file class
+    if (_shared) MappedFile::shutdown();
+
     // is the callback registered?
     if (_onShutdown) _onShutdown();
 
@@ -474,6 +603,46 @@ void ExtensionImpl::iniVariables(const std::function<void(Ini &ini)> &callback)
     for (auto ini : _ini_entries) callback(*ini);
 }
 
+/**
+ *  Register the module globals
+ *  @param  globals     The globals to register (ownership is taken)
+ *  @return ModuleGlobalsBase
+ */
+ModuleGlobalsBase *ExtensionImpl::globals(ModuleGlobalsBase *globals)
+{
+    // take ownership
+    std::unique_ptr<ModuleGlobalsBase> object(globals);
+
+    // the module only has room for one struct, a second call must register the same type
+    // (the construct function is different for each type)
+    if (_globals && (_globals->_construct != object->_construct || _globals->_size != object->_size)) throw Error("Module globals of a different type are already registered");
+
+    // the struct that was registered first is used
+    if (_globals) return _globals.get();
+
+    // the struct can no longer be added when the module is locked
+    if (_locked) throw Error("Module globals can not be registered after the extension is locked");
+
+    // store the object
+    _globals = std::move(object);
+
+    // the Zend engine allocates (on thread safe builds), constructs and destructs the struct
+    _entry.globals_size = _globals->_size;
+    _entry.globals_ctor = _globals->_construct;
+    _entry.globals_dtor = _globals->_destruct;
+
+#ifdef ZTS
+    // each thread gets its own struct, that is found with this id
+    _entry.globals_id_ptr = &_globals->_id;
+#else
+    // there is only one struct, in memory that was allocated by the object
+    _entry.globals_ptr = _globals->_data;
+#endif
+
+    // done
+    return _globals.get();
+}
+
 /**
  *  End of namespace
  */
@@ -49,6 +49,20 @@ protected:
      *  @var    list
      */
     std::list<std::shared_ptr<Ini>> _ini_entries;
+
+    /**
+     *  Does this extension expose the settings and functions that are shared
+     *  by all extensions (like the phpcpp_stats() function and the "phpcpp.*"
+     *  php.ini settings)? Only the first extension that is loaded does this.
+     *  @var    bool
+     */
+    bool _shared = false;
+
+    /**
+     *  The module globals of the extension
+     *  @var    std::unique_ptr<ModuleGlobalsBase>
+     */
+    std::unique_ptr<ModuleGlobalsBase> _globals;
     
 public:
     /**
@@ -111,6 +125,19 @@ public:
      *  @param  callback
      */
     void iniVariables(const std::function<void(Ini &ini)> &callback);
+
+    /**
+     *  Register the module globals
+     *
+     *  When the globals were already registered (because get_module() is
+     *  called again after an "apache reload") the new object is discarded,
+     *  and the registered object is returned.
+     *
+     *  @param  globals     The globals to register (ownership is taken)
+     *  @return ModuleGlobalsBase
+     *  @throws Error       When globals of a different type were registered, or when locked
+     */
+    ModuleGlobalsBase *globals(ModuleGlobalsBase *globals);
      
     /** 
      *  Is the object locked (true) or is it still possible to add more functions,
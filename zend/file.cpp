@@ -28,13 +28,8 @@ namespace Php {
  */
 File::File(const char *name, size_t size) : _original(zend_string_init(name, size, 0))
 {
-#if PHP_VERSION_ID < 80100
-    // resolve the path
-    _path = zend_resolve_path(name, size);
-#else
-    // first convert the path, then read it
-    _path = zend_resolve_path(_original);
-#endif
+    // resolve the path (the cache remembers paths that were resolved before)
+    _path = FileCache::resolve(_original);
 }
 
 /**
@@ -61,6 +56,10 @@ bool File::compile()
     // is the file already compiled?
     if (_opcodes) return _opcodes->valid();
 
+    // was it compiled earlier in this request?
+    _opcodes = FileCache::opcodes(_path);
+    if (_opcodes) return true;
+
     // we are going to open the file
     zend_file_handle fileHandle;
 
@@ -85,11 +84,14 @@ bool File::compile()
     CompilerOptions options(ZEND_COMPILE_DEFAULT);
 
     // create the opcodes
-    _opcodes.reset(new Opcodes(zend_compile_file(&fileHandle, ZEND_INCLUDE)));
+    _opcodes = std::make_shared<Opcodes>(zend_compile_file(&fileHandle, ZEND_INCLUDE));
 
     // close the file handle
     zend_destroy_file_handle(&fileHandle);
 
+    // store the opcodes for the next time this file is used in this request
+    FileCache::store(_path, _opcodes);
+
     // done
     return _opcodes->valid();
 }
@@ -106,9 +108,8 @@ bool File::exists()
     // if we have valid opcodes, we're sure that it exists
     if (_opcodes && _opcodes->valid()) return true;
 
-    // retrieve stats
-    struct stat buf;
-    return stat(ZSTR_VAL(_path), &buf) == 0;
+    // check the file (the cache remembers files that were checked before)
+    return FileCache::exists(_path);
 }
 
 /**
@@ -126,9 +127,31 @@ bool File::valid()
  *  @return Value
  */
 Value File::execute()
+{
+    // execute in the scope of the caller
+    return execute(nullptr);
+}
+
+/**
+ *  Execute the file in an isolated scope
+ *  @param  scope       The scope with the variables
+ *  @return Value
+ */
+Value File::execute(Scope &scope)
+{
+    // execute with the variables of the scope
+    return execute(scope.symbols());
+}
+
+/**
+ *  Execute the file
+ *  @param  symbols     Symbol table of an isolated scope, or nullptr
+ *  @return Value
+ */
+Value File::execute(zend_array *symbols)
 {
     // do we already have the opcodes?
-    if (_opcodes) return _opcodes->execute();
+    if (_opcodes) return _opcodes->execute(symbols);
 
     // try compiling the file
     if (!compile()) return nullptr;
@@ -137,7 +160,7 @@ Value File::execute()
     zend_hash_add_empty_element(&EG(included_files), _path);
 
     // execute the opcodes
-    return _opcodes->execute();
+    return _opcodes->execute(symbols);
 }
 
 /**
@@ -156,6 +179,16 @@ Value File::once()
     return execute();
 }
 
+/**
+ *  Statistics of the file cache of the current thread
+ *  @return Value
+ */
+Value File::statistics()
+{
+    // pass on to the cache
+    return FileCache::report();
+}
+
 /**
  *  End of namespace
  */
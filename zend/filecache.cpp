@@ -0,0 +1,340 @@
+/**
+ *  FileCache.cpp
+ *
+ *  Implementation file for the cache of resolved and compiled files
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Information about a resolved file during a request
+ */
+struct CachedFile
+{
+    /**
+     *  Is the file known to exist?
+     *  @var    bool
+     */
+    bool exists = false;
+
+    /**
+     *  The compiled file
+     *  @var    std::shared_ptr<Opcodes>
+     */
+    std::shared_ptr<Opcodes> opcodes;
+};
+
+/**
+ *  A path that is remembered across requests
+ */
+struct CachedPath
+{
+    /**
+     *  The resolved path
+     *  @var    std::string
+     */
+    std::string path;
+
+    /**
+     *  Time when the path expires
+     *  @var    time_t
+     */
+    time_t expires;
+};
+
+/**
+ *  The cache of a single thread
+ */
+class ThreadFiles
+{
+public:
+    /**
+     *  Is the cache enabled (this is only the case during a request)
+     *  @var    bool
+     */
+    bool enabled = false;
+
+    /**
+     *  Number of seconds that absolute paths are remembered across requests
+     *  @var    time_t
+     */
+    time_t ttl = 0;
+
+    /**
+     *  Resolved absolute paths during this request, indexed by the original name
+     *  @var    std::unordered_map
+     */
+    std::unordered_map<std::string, zend_string*> paths;
+
+    /**
+     *  The files during this request, indexed by the resolved path
+     *  @var    std::unordered_map
+     */
+    std::unordered_map<std::string, CachedFile> files;
+
+    /**
+     *  Absolute paths that are remembered across requests
+     *  @var    std::unordered_map
+     */
+    std::unordered_map<std::string, CachedPath> persistent;
+
+    /**
+     *  Number of hits and misses
+     *  @var    uint64_t
+     */
+    uint64_t resolveHits = 0;
+    uint64_t resolveMisses = 0;
+    uint64_t statHits = 0;
+    uint64_t statMisses = 0;
+    uint64_t compileHits = 0;
+    uint64_t compileMisses = 0;
+
+    /**
+     *  Remove everything that was stored during the request
+     */
+    void clear()
+    {
+        // release the paths
+        for (auto &iter : paths) zend_string_release(iter.second);
+
+        // forget everything (this also destructs the opcodes)
+        paths.clear();
+        files.clear();
+    }
+};
+
+/**
+ *  The cache of the current thread
+ *  @var    ThreadFiles
+ */
+static thread_local ThreadFiles cache;
+
+/**
+ *  Helper function to resolve a file name using the include path
+ *  @param  name        The file name
+ *  @return zend_string
+ */
+static zend_string *lookup(zend_string *name)
+{
+#if PHP_VERSION_ID < 80100
+    // resolve the path
+    return zend_resolve_path(ZSTR_VAL(name), ZSTR_LEN(name));
+#else
+    // resolve the path
+    return zend_resolve_path(name);
+#endif
+}
+
+/**
+ *  Resolve a file name using the include path
+ *  @param  name        The file name
+ *  @return zend_string The resolved path (a new reference), or nullptr if it does not exist
+ */
+zend_string *FileCache::resolve(zend_string *name)
+{
+    // relative names depend on the include path, the working directory and
+    // the script that is running, so only absolute names are cached
+    if (!cache.enabled || !IS_ABSOLUTE_PATH(ZSTR_VAL(name), ZSTR_LEN(name))) return lookup(name);
+
+    // the key in the cache
+    std::string key(ZSTR_VAL(name), ZSTR_LEN(name));
+
+    // was the name already resolved in this request?
+    auto iter = cache.paths.find(key);
+    if (iter != cache.paths.end())
+    {
+        // update the counter
+        cache.resolveHits += 1;
+
+        // share the path
+        return zend_string_copy(iter->second);
+    }
+
+    // the resolved path
+    zend_string *path = nullptr;
+
+    // do we still know the path from an earlier request?
+    auto known = cache.ttl > 0 ? cache.persistent.find(key) : cache.persistent.end();
+    if (known != cache.persistent.end() && known->second.expires > time(nullptr))
+    {
+        // update the counter
+        cache.resolveHits += 1;
+
+        // use the path
+        path = zend_string_init(known->second.path.data(), known->second.path.size(), 0);
+    }
+    else
+    {
+        // update the counter
+        cache.resolveMisses += 1;
+
+        // resolve the path, a file that does not exist is not remembered
+        // because it may be created later on
+        path = lookup(name);
+        if (!path) return nullptr;
+
+        // remember it for later requests
+        if (cache.ttl > 0) cache.persistent[key] = CachedPath{ std::string(ZSTR_VAL(path), ZSTR_LEN(path)), time(nullptr) + cache.ttl };
+    }
+
+    // remember the path for this request
+    cache.paths[key] = zend_string_copy(path);
+
+    // done
+    return path;
+}
+
+/**
+ *  Does a resolved path exist?
+ *  @param  path        The resolved path
+ *  @return bool
+ */
+bool FileCache::exists(zend_string *path)
+{
+    // the stat buffer
+    struct stat buf;
+
+    // without the cache we just check the file
+    if (!cache.enabled) return stat(ZSTR_VAL(path), &buf) == 0;
+
+    // the file in the cache
+    auto &file = cache.files[std::string(ZSTR_VAL(path), ZSTR_LEN(path))];
+
+    // is this already known?
+    if (file.exists)
+    {
+        // update the counter
+        cache.statHits += 1;
+
+        // the file exists
+        return true;
+    }
+
+    // update the counter
+    cache.statMisses += 1;
+
+    // check the file (a file that does not exist is checked again next time,
+    // because it may be created later on)
+    return file.exists = stat(ZSTR_VAL(path), &buf) == 0;
+}
+
+/**
+ *  Retrieve the opcodes of a file that was compiled earlier in the request
+ *  @param  path        The resolved path
+ *  @return std::shared_ptr<Opcodes>
+ */
+std::shared_ptr<Opcodes> FileCache::opcodes(zend_string *path)
+{
+    // without the cache, the file must be compiled
+    if (!cache.enabled) return nullptr;
+
+    // look up the file
+    auto iter = cache.files.find(std::string(ZSTR_VAL(path), ZSTR_LEN(path)));
+
+    // was it compiled before?
+    if (iter != cache.files.end() && iter->second.opcodes)
+    {
+        // update the counter
+        cache.compileHits += 1;
+
+        // share the opcodes
+        return iter->second.opcodes;
+    }
+
+    // update the counter
+    cache.compileMisses += 1;
+
+    // the file must be compiled
+    return nullptr;
+}
+
+/**
+ *  Store the opcodes of a file
+ *  @param  path        The resolved path
+ *  @param  opcodes     The compiled file
+ */
+void FileCache::store(zend_string *path, const std::shared_ptr<Opcodes> &opcodes)
+{
+    // files with errors are not cached, so that the error is reported every time
+    if (!cache.enabled || !opcodes->valid()) return;
+
+    // the file in the cache
+    auto &file = cache.files[std::string(ZSTR_VAL(path), ZSTR_LEN(path))];
+
+    // a file that was compiled surely exists
+    file.exists = true;
+    file.opcodes = opcodes;
+}
+
+/**
+ *  Start using the cache for a new request
+ *  @param  enabled     Is the cache enabled?
+ *  @param  ttl         Number of seconds that resolved paths are kept across requests
+ */
+void FileCache::start(bool enabled, time_t ttl)
+{
+    // set the options
+    cache.enabled = enabled;
+    cache.ttl = ttl;
+
+    // paths from earlier requests are no longer used
+    if (ttl == 0 || !enabled) cache.persistent.clear();
+
+    // the paths are only checked once in a while for expiry
+    if (cache.persistent.size() < 1024) return;
+
+    // the current time
+    time_t now = time(nullptr);
+
+    // remove the expired paths
+    for (auto iter = cache.persistent.begin(); iter != cache.persistent.end(); )
+    {
+        // is this path expired?
+        if (iter->second.expires <= now) iter = cache.persistent.erase(iter);
+        else ++iter;
+    }
+}
+
+/**
+ *  Empty the cache at the end of the request
+ */
+void FileCache::stop()
+{
+    // files that are used after this (by other extensions) are not cached
+    cache.enabled = false;
+
+    // the paths and opcodes live on the request heap, so they must be released now
+    cache.clear();
+}
+
+/**
+ *  The number of hits and misses of this thread
+ *  @return Value
+ */
+Value FileCache::report()
+{
+    // the result
+    Array result;
+
+    // add the counters
+    result["resolve_hits"] = (int64_t)cache.resolveHits;
+    result["resolve_misses"] = (int64_t)cache.resolveMisses;
+    result["stat_hits"] = (int64_t)cache.statHits;
+    result["stat_misses"] = (int64_t)cache.statMisses;
+    result["compile_hits"] = (int64_t)cache.compileHits;
+    result["compile_misses"] = (int64_t)cache.compileMisses;
+
+    // done
+    return result;
+}
+
+/**
+ *  End namespace
+ */
+}
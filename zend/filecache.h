@@ -0,0 +1,75 @@
+/**
+ *  FileCache.h
+ *
+ *  Cache for Php::File (and thus for Php::include() and Php::require()),
+ *  that remembers during a request how absolute file names were resolved,
+ *  which files exist, and the compiled opcodes. Resolved absolute paths can
+ *  also be remembered across requests, for a number of seconds that is set
+ *  with the "phpcpp.file_cache_ttl" php.ini setting. Files that do not exist
+ *  are never remembered. The cache is turned on with "phpcpp.file_cache = 1".
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class FileCache
+{
+public:
+    /**
+     *  Resolve a file name using the include path
+     *  @param  name        The file name
+     *  @return zend_string The resolved path (a new reference), or nullptr if it does not exist
+     */
+    static zend_string *resolve(zend_string *name);
+
+    /**
+     *  Does a resolved path exist?
+     *  @param  path        The resolved path
+     *  @return bool
+     */
+    static bool exists(zend_string *path);
+
+    /**
+     *  Retrieve the opcodes of a file that was compiled earlier in the request
+     *  @param  path        The resolved path
+     *  @return std::shared_ptr<Opcodes>
+     */
+    static std::shared_ptr<Opcodes> opcodes(zend_string *path);
+
+    /**
+     *  Store the opcodes of a file
+     *  @param  path        The resolved path
+     *  @param  opcodes     The compiled file
+     */
+    static void store(zend_string *path, const std::shared_ptr<Opcodes> &opcodes);
+
+    /**
+     *  Start using the cache for a new request
+     *  @param  enabled     Is the cache enabled?
+     *  @param  ttl         Number of seconds that resolved paths are kept across requests
+     */
+    static void start(bool enabled, time_t ttl);
+
+    /**
+     *  Empty the cache at the end of the request
+     */
+    static void stop();
+
+    /**
+     *  The number of hits and misses of this thread
+     *  @return Value
+     */
+    static Value report();
+};
+
+/**
+ *  End namespace
+ */
+}
@@ -17,11 +17,17 @@
  */
 namespace Php {
 
+/**
+ *  Constructor
+ *  @param  closure         The closure to be wrapped
+ */
+Function::Function(Closure &&closure) : Value(Object(Functor::entry(), new Functor(std::move(closure)))) {}
+
 /**
  *  Constructor
  *  @param  function        The function to be wrapped
  */
-Function::Function(const std::function<Php::Value(Php::Parameters&)> &function) : Value(Object(Functor::entry(), new Functor(function))) {}
+Function::Function(const std::function<Php::Value(Php::Parameters&)> &function) : Function(Closure(function)) {}
 
 /**
  *  End of namespace
@@ -23,6 +23,12 @@ namespace Php {
  */
 zend_class_entry *Functor::_entry = nullptr;
 
+/**
+ *  The function that is called when the functor is invoked
+ *  @var zend_internal_function
+ */
+zend_internal_function Functor::_function;
+
 /**
  *  Initialize the class
  */
@@ -36,6 +42,77 @@ void Functor::initialize()
 
     // initialize the functor class
     _entry = functor->implementation()->initialize(functor.get(), "");
+
+    // the function that is called when the functor is invoked
+    memset(&_function, 0, sizeof(zend_internal_function));
+    _function.type          = ZEND_INTERNAL_FUNCTION;
+    _function.fn_flags      = ZEND_ACC_PUBLIC;
+    _function.function_name = zend_new_interned_string(zend_string_init("__invoke", sizeof("__invoke") - 1, 1));
+    _function.scope         = _entry;
+    _function.handler       = &Functor::invoke;
+
+    // the functor is invoked with this function, instead of with the
+    // function that is allocated for every call to other __invoke() methods
+    ClassImpl::objectHandlers(_entry)->get_closure = &Functor::getClosure;
+}
+
+/**
+ *  Handler that is called by the Zend engine when the functor is invoked
+ *  @param  execute_data
+ *  @param  return_value
+ */
+void Functor::invoke(INTERNAL_FUNCTION_PARAMETERS)
+{
+    // construct parameters
+    ParametersImpl params(getThis(), ZEND_NUM_ARGS());
+
+    // the functor that is invoked
+    auto *functor = static_cast<Functor*>(params.object());
+
+    // the closure could throw an exception
+    try
+    {
+        // call the closure
+        Value result(functor->_closure(params));
+
+        // return a full copy of the zval, and do not destruct it
+        RETVAL_ZVAL(result._val, 1, 0);
+    }
+    catch (Throwable &throwable)
+    {
+        // an exception was not caught by the extension, let it bubble up
+        throwable.rethrow();
+    }
+}
+
+/**
+ *  Method that returns the function to call when the functor is invoked
+ *  @param  object
+ *  @param  entry_ptr
+ *  @param  func
+ *  @param  object_ptr
+ *  @return int
+ */
+#if PHP_VERSION_ID < 80000
+int Functor::getClosure(ZEND_OBJECT_OR_ZVAL object, zend_class_entry **entry_ptr, zend_function **func, zend_object **object_ptr)
+#elif PHP_VERSION_ID < 80200
+int Functor::getClosure(ZEND_OBJECT_OR_ZVAL object, zend_class_entry **entry_ptr, zend_function **func, zend_object **object_ptr, zend_bool check_only)
+#else
+zend_result Functor::getClosure(ZEND_OBJECT_OR_ZVAL object, zend_class_entry **entry_ptr, zend_function **func, zend_object **object_ptr, zend_bool check_only)
+#endif
+{
+    // the function is shared by all functors, and is not freed after the call
+    *func = (zend_function *)&_function;
+
+    // the object on which the function is called
+#if PHP_VERSION_ID < 80000
+    *object_ptr = Z_OBJ_P(object);
+#else
+    *object_ptr = object;
+#endif
+
+    // done
+    return SUCCESS;
 }
 
 /**
@@ -1,13 +1,13 @@
 /**
  *  Functor.h
  *
- *  We want to be able to wrap a std::function in an object and pass
+ *  We want to be able to wrap a C++ function in an object and pass
  *  that to PHP. The normal "Closure" class from the Zend engine
  *  would be very suitable for that. However, the Zend engine does
  *  not really allow us to add a secret pointer to such closure object.
  *
  *  Therefore, we create our own Closure class, this time using PHP-CPP
- *  code, to wrap a std::function.
+ *  code, to wrap a Php::Closure.
  *
  *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
  *  @copyright 2015 Copernica BV
@@ -26,9 +26,9 @@ class Functor : public Base
 public:
     /**
      *  Constructor
-     *  @param  function    The function to wrap
+     *  @param  closure     The closure to wrap
      */
-    Functor(const std::function<Value(Parameters &params)> &function) : _function(function) {}
+    Functor(Closure &&closure) : _closure(std::move(closure)) {}
 
     /**
      *  Destructor
@@ -42,8 +42,8 @@ public:
      */
     Value __invoke(Parameters &params) const
     {
-        // pass on to the function
-        return _function(params);
+        // pass on to the closure
+        return _closure(params);
     }
 
     /**
@@ -68,10 +68,10 @@ public:
 
 private:
     /**
-     *  The std::function that is wrapped in PHP code
-     *  @var std::function
+     *  The closure that is wrapped in PHP code
+     *  @var Closure
      */
-    const std::function<Value(Parameters &params)> _function;
+    const Closure _closure;
 
     /**
      *  The classentry
@@ -79,6 +79,37 @@ private:
      */
     static zend_class_entry *_entry;
 
+    /**
+     *  The function that is called when the functor is invoked, this is
+     *  allocated once, instead of for every call (which is what the generic
+     *  __invoke() handling of PHP-CPP classes does)
+     *  @var zend_internal_function
+     */
+    static zend_internal_function _function;
+
+    /**
+     *  Handler that is called by the Zend engine when the functor is invoked
+     *  @param  execute_data
+     *  @param  return_value
+     */
+    static void invoke(INTERNAL_FUNCTION_PARAMETERS);
+
+    /**
+     *  Method that returns the function to call when the functor is invoked
+     *  @param  object
+     *  @param  entry_ptr
+     *  @param  func
+     *  @param  object_ptr
+     *  @return int
+     */
+#if PHP_VERSION_ID < 80000
+    static int getClosure(ZEND_OBJECT_OR_ZVAL object, zend_class_entry **entry_ptr, zend_function **func, zend_object **object_ptr);
+#elif PHP_VERSION_ID < 80200
+    static int getClosure(ZEND_OBJECT_OR_ZVAL object, zend_class_entry **entry_ptr, zend_function **func, zend_object **object_ptr, zend_bool check_only);
+#else
+    static zend_result getClosure(ZEND_OBJECT_OR_ZVAL object, zend_class_entry **entry_ptr, zend_function **func, zend_object **object_ptr, zend_bool check_only);
+#endif
+
 };
 
 /**
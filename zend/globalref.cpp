@@ -0,0 +1,410 @@
+/**
+ *  GlobalRef.cpp
+ *
+ *  Implementation file for the GlobalRef class
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Create a persistent key with a precomputed hash
+ *  @param  name        The key
+ *  @param  size        Size of the key
+ *  @return zend_string
+ */
+static zend_string *make_key(const char *name, size_t size)
+{
+    // create the string, it is used in every request
+    auto *key = zend_string_init(name, size, 1);
+
+    // calculate the hash right away, so that lookups do not have to do that
+    zend_string_hash_val(key);
+
+    // done
+    return key;
+}
+
+/**
+ *  Find a key in a table, using the bucket in which it was found before
+ *  @param  table       The table to search in
+ *  @param  key         The key to look for
+ *  @param  bucket      The remembered bucket
+ *  @return zval
+ */
+static zval *find_key(HashTable *table, zend_string *key, Bucket *&bucket)
+{
+#ifndef ZTS
+    // the remembered bucket may only be used if it is still part of the table
+    // and still holds the same key (the table may have been resized or the
+    // variable may have been unset in the meantime)
+    if (bucket != nullptr
+#if PHP_VERSION_ID >= 80200
+        && !HT_IS_PACKED(table)
+#endif
+        && bucket >= table->arData && bucket < table->arData + table->nNumUsed
+        && Z_TYPE(bucket->val) != IS_UNDEF && bucket->key && zend_string_equals(bucket->key, key)) return &bucket->val;
+#endif
+
+    // look up the key, the hash was already calculated
+    auto *result = zend_hash_find(table, key);
+
+#ifndef ZTS
+    // remember the bucket (the value is the first member of a bucket)
+    bucket = reinterpret_cast<Bucket *>(result);
+#endif
+
+    // done
+    return result;
+}
+
+/**
+ *  Follow indirect values (used for variables of the global scope) and references
+ *  @param  value       The value that was found
+ *  @return zval
+ */
+static zval *follow(zval *value)
+{
+    // was the key not found?
+    if (value == nullptr) return nullptr;
+
+    // variables of the global scope may be stored in a compiled variable
+    if (Z_TYPE_P(value) == IS_INDIRECT) value = Z_INDIRECT_P(value);
+
+    // a compiled variable may not be set
+    if (Z_TYPE_P(value) == IS_UNDEF) return nullptr;
+
+    // follow the reference
+    ZVAL_DEREF(value);
+
+    // done
+    return value;
+}
+
+/**
+ *  Replace the value of a variable
+ *  @param  target      The variable to update
+ *  @param  value       The new value (whose reference is taken over)
+ */
+static void replace(zval *target, zval *value)
+{
+    // the old value is destructed after the assignment, so that destructors
+    // that run will see the new value
+    zval garbage;
+    ZVAL_COPY_VALUE(&garbage, target);
+    ZVAL_COPY_VALUE(target, value);
+    zval_ptr_dtor(&garbage);
+}
+
+/**
+ *  Constructor for a handle to a global variable
+ *  @param  name        Name of the variable (without the dollar sign)
+ *  @param  size        Size of the name
+ */
+GlobalRef::GlobalRef(const char *name, size_t size) : _key(make_key(name, size)) {}
+
+/**
+ *  Constructor for a handle to an element of a super global
+ *  @param  super       The super global, like Php::SERVER
+ *  @param  key         Key of the element
+ *  @param  size        Size of the key
+ */
+GlobalRef::GlobalRef(Super &super, const char *key, size_t size) : _super(&super), _key(make_key(key, size)) {}
+
+/**
+ *  Destructor
+ */
+GlobalRef::~GlobalRef()
+{
+    // forget the key
+    zend_string_release(_key);
+}
+
+/**
+ *  The table that holds the variable
+ *  @param  separate    Should a shared super global be separated first?
+ *  @return HashTable
+ */
+HashTable *GlobalRef::table(bool separate) const
+{
+    // global variables are stored in the symbol table
+    if (_super == nullptr) return &EG(symbol_table);
+
+    // find the super global in the symbol table
+    auto *value = follow(find_key(&EG(symbol_table), _super->_key, _parent));
+
+    // just-in-time super globals (like $_SERVER) are only added to the symbol
+    // table when they are used for the first time in a request
+    if (value == nullptr && zend_is_auto_global(_super->_key)) value = follow(find_key(&EG(symbol_table), _super->_key, _parent));
+
+    // the super global could have been overwritten by a script
+    if (value == nullptr || Z_TYPE_P(value) != IS_ARRAY) return nullptr;
+
+    // the array may be shared with other variables, which should not change
+    if (separate) SEPARATE_ARRAY(value);
+
+    // done
+    return Z_ARRVAL_P(value);
+}
+
+/**
+ *  Find the variable
+ *  @return zval
+ */
+zval *GlobalRef::lookup() const
+{
+    // the table that holds the variable
+    auto *table = this->table(false);
+
+    // find the variable in the table
+    return table ? follow(find_key(table, _key, _bucket)) : nullptr;
+}
+
+/**
+ *  Find the variable, and create it if it does not yet exist
+ *  @return zval
+ */
+zval *GlobalRef::create()
+{
+    // the table that holds the variable
+    auto *table = this->table(true);
+
+    // the super global is not an array
+    if (table == nullptr) return nullptr;
+
+    // find the variable in the table
+    auto *value = find_key(table, _key, _bucket);
+
+    // is the variable already in the table?
+    if (value != nullptr)
+    {
+        // compiled variables of the global scope may be not set, but
+        // can be assigned all the same
+        if (Z_TYPE_P(value) == IS_INDIRECT) value = Z_INDIRECT_P(value);
+
+        // follow the reference
+        ZVAL_DEREF(value);
+
+        // done
+        return value;
+    }
+
+    // the table holds keys that belong to the request
+    auto *key = zend_string_init(ZSTR_VAL(_key), ZSTR_LEN(_key), 0);
+
+    // add the variable to the table
+    zval null;
+    ZVAL_NULL(&null);
+    value = zend_hash_add_new(table, key, &null);
+
+    // the table has its own reference to the key
+    zend_string_release(key);
+
+    // done
+    return value;
+}
+
+/**
+ *  Does the variable exist (and is it not null)?
+ *  @return bool
+ */
+bool GlobalRef::exists() const
+{
+    // find the variable
+    auto *value = lookup();
+
+    // check the type
+    return value != nullptr && Z_TYPE_P(value) != IS_NULL;
+}
+
+/**
+ *  The value of the variable (null if it does not exist)
+ *  @return Value
+ */
+Value GlobalRef::value() const
+{
+    // find the variable
+    auto *value = lookup();
+
+    // did the variable exist?
+    if (!value) return nullptr;
+
+    // return the valid result
+    return value;
+}
+
+/**
+ *  The value as a number
+ *  @return int64_t
+ */
+int64_t GlobalRef::numericValue() const
+{
+    // find the variable
+    auto *value = lookup();
+
+    // convert the value
+    return value ? zval_get_long(value) : 0;
+}
+
+/**
+ *  The value as a boolean
+ *  @return bool
+ */
+bool GlobalRef::boolValue() const
+{
+    // find the variable
+    auto *value = lookup();
+
+    // convert the value
+    return value && zend_is_true(value);
+}
+
+/**
+ *  The value as a floating point number
+ *  @return double
+ */
+double GlobalRef::floatValue() const
+{
+    // find the variable
+    auto *value = lookup();
+
+    // convert the value
+    return value ? zval_get_double(value) : 0.0;
+}
+
+/**
+ *  Access to the buffer of a string variable
+ *  @return const char *
+ */
+const char *GlobalRef::rawValue() const
+{
+    // find the variable
+    auto *value = lookup();
+
+    // only strings have a buffer
+    return value && Z_TYPE_P(value) == IS_STRING ? Z_STRVAL_P(value) : nullptr;
+}
+
+/**
+ *  Size of a string variable
+ *  @return size_t
+ */
+size_t GlobalRef::size() const
+{
+    // find the variable
+    auto *value = lookup();
+
+    // only strings have a size
+    return value && Z_TYPE_P(value) == IS_STRING ? Z_STRLEN_P(value) : 0;
+}
+
+/**
+ *  The value of the variable as a std::string
+ *  @return std::string
+ */
+std::string GlobalRef::stringValue() const
+{
+    // find the variable
+    auto *value = lookup();
+
+    // strings can be copied right away
+    if (value && Z_TYPE_P(value) == IS_STRING) return std::string(Z_STRVAL_P(value), Z_STRLEN_P(value));
+
+    // other types have to be converted
+    return value ? Value(value).stringValue() : std::string();
+}
+
+/**
+ *  Assign a new value to the variable
+ *  @param  value       The new value
+ *  @return GlobalRef
+ */
+GlobalRef &GlobalRef::operator=(const Value &value)
+{
+    // find or create the variable
+    auto *target = create();
+
+    // the super global is not an array
+    if (target == nullptr) return *this;
+
+    // make a copy of the value
+    zval copy;
+    ZVAL_COPY(&copy, value._val);
+
+    // store the copy
+    replace(target, &copy);
+
+    // allow chaining
+    return *this;
+}
+
+/**
+ *  Assign a number
+ *  @param  value       The new value
+ *  @return GlobalRef
+ */
+GlobalRef &GlobalRef::operator=(int64_t value)
+{
+    // find or create the variable
+    auto *target = create();
+
+    // the super global is not an array
+    if (target == nullptr) return *this;
+
+    // numbers can be overwritten
+    if (Z_TYPE_P(target) == IS_LONG) ZVAL_LONG(target, value);
+
+    // other values have to be destructed
+    else { zval number; ZVAL_LONG(&number, value); replace(target, &number); }
+
+    // allow chaining
+    return *this;
+}
+
+/**
+ *  Assign a string value
+ *  @param  value       The new value
+ *  @param  size        Size of the value
+ *  @return GlobalRef
+ */
+GlobalRef &GlobalRef::assign(const char *value, size_t size)
+{
+    // find or create the variable
+    auto *target = create();
+
+    // the super global is not an array
+    if (target == nullptr) return *this;
+
+    // a string of the same size that is not shared can be overwritten
+    if (Z_TYPE_P(target) == IS_STRING && Z_STRLEN_P(target) == size && !ZSTR_IS_INTERNED(Z_STR_P(target)) && Z_REFCOUNT_P(target) == 1)
+    {
+        // copy the new value into the buffer (it may overlap with the old value)
+        memmove(Z_STRVAL_P(target), value, size);
+
+        // the hash belonged to the old value
+        zend_string_forget_hash_val(Z_STR_P(target));
+    }
+    else
+    {
+        // create a new string (before the old value is destructed, because
+        // the new value could be part of it)
+        zval string;
+        ZVAL_STRINGL(&string, value, size);
+
+        // store the new string
+        replace(target, &string);
+    }
+
+    // allow chaining
+    return *this;
+}
+
+/**
+ *  End namespace
+ */
+}
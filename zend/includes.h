@@ -20,15 +20,28 @@
 #include <initializer_list>
 #include <vector>
 #include <map>
+#include <tuple>
+#include <unordered_map>
 #include <set>
 #include <memory>
 #include <list>
 #include <exception>
 #include <type_traits>
 #include <functional>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+
+// for reading the time stamp counter
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
 
 // for debug
 #include <iostream>
+#include <cmath>
 
 //#define ZTS
 //#define THREAD_T pthread_t
@@ -42,6 +55,7 @@
 #include <zend_interfaces.h>
 #include <zend_ini.h>
 #include <zend_closures.h>
+#include <zend_extensions.h>
 #include <SAPI.h>
 
 /**
@@ -66,6 +80,8 @@
 #include "../include/platform.h"
 #include "../include/version.h"
 #include "../include/inivalue.h"
+#include "../include/iniref.h"
+#include "../include/moduleglobals.h"
 #include "../include/ini.h"
 #include "../include/throwable.h"
 #include "../include/exception.h"
@@ -78,6 +94,7 @@
 #include "../include/valueiterator.h"
 #include "../include/array.h"
 #include "../include/object.h"
+#include "../include/result.h"
 #include "../include/globals.h"
 #include "../include/argument.h"
 #include "../include/byval.h"
@@ -85,6 +102,7 @@
 #include "../include/global.h"
 #include "../include/hashmember.h"
 #include "../include/super.h"
+#include "../include/globalref.h"
 #include "../include/parameters.h"
 #include "../include/modifiers.h"
 #include "../include/base.h"
@@ -97,15 +115,22 @@
 #include "../include/classbase.h"
 #include "../include/interface.h"
 #include "../include/constant.h"
+#include "../include/constantentry.h"
+#include "../include/constantref.h"
+#include "../include/classref.h"
 #include "../include/zendcallable.h"
 #include "../include/class.h"
 #include "../include/namespace.h"
 #include "../include/extension.h"
 #include "../include/call.h"
+#include "../include/scope.h"
 #include "../include/script.h"
+#include "../include/persistentscript.h"
 #include "../include/file.h"
+#include "../include/closure.h"
 #include "../include/function.h"
 #include "../include/stream.h"
+#include "../include/outputwriter.h"
 
 /**
  *  Common header files for internal use only
@@ -136,6 +161,7 @@
 #include "traverseiterator.h"
 #include "iteratorimpl.h"
 #include "classimpl.h"
+#include "statistics.h"
 #include "objectimpl.h"
 #include "parametersimpl.h"
 #include "extensionimpl.h"
@@ -144,7 +170,13 @@
 #include "rethrowable.h"
 #include "state.h"
 #include "opcodes.h"
+#include "scriptcache.h"
+#include "filecache.h"
+#include "errorlimiter.h"
+#include "constantcache.h"
+#include "persistentopcodes.h"
 #include "functor.h"
+#include "mappedfile.h"
 #include "constantimpl.h"
 #include "delayedfree.h"
 #include "extensionpath.h"
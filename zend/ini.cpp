@@ -12,6 +12,112 @@
  */
 namespace Php {
 
+/**
+ *  Handler that is called by the Zend engine when a setting changes
+ */
+struct IniHandler
+{
+    /**
+     *  Check if a value is a boolean "true" (just like OnUpdateBool does)
+     *  @param  value
+     *  @param  size
+     *  @return bool
+     */
+    static bool truthy(const char *value, size_t size)
+    {
+        // the words that are true
+        if (size == 2 && strcasecmp(value, "on") == 0) return true;
+        if (size == 3 && strcasecmp(value, "yes") == 0) return true;
+        if (size == 4 && strcasecmp(value, "true") == 0) return true;
+
+        // other values are true when they are a number other than zero
+        return ZEND_STRTOL(value, nullptr, 10) != 0;
+    }
+
+    /**
+     *  Convert a value the same way as zend_ini_long() and zend_ini_double() do
+     *  @param  values      the converted values
+     *  @param  value       the new value (the buffer is owned by the setting)
+     *  @param  size        size of the value
+     */
+    static void convert(IniRef::Values &values, const char *value, size_t size)
+    {
+        // convert the value
+        values.numeric = ZEND_STRTOL(value, nullptr, 0);
+        values.floating = zend_strtod(value, nullptr);
+        values.boolean = truthy(value, size);
+        values.string = value;
+        values.size = size;
+        values.valid = true;
+    }
+
+    /**
+     *  The values of a handle in the table of the current thread
+     *  @param  slot        index in the table
+     *  @return IniRef::Values
+     */
+    static IniRef::Values &local(int slot)
+    {
+        // the table of the current thread
+        static thread_local std::vector<IniRef::Values> table;
+
+        // make sure that there is room for the handle
+        if (table.size() <= (size_t)slot) table.resize(slot + 1);
+
+        // expose the values
+        return table[slot];
+    }
+
+    /**
+     *  Update the handle that is bound to the setting
+     *  @param  entry       the setting
+     *  @param  new_value   the new value
+     *  @param  mh_arg1     the handle
+     *  @return int
+     */
+    static ZEND_INI_MH(update)
+    {
+        // the handle that is bound to the setting
+        auto *ref = static_cast<IniRef *>(mh_arg1);
+
+        // settings without a handle accept every value
+        if (ref == nullptr) return SUCCESS;
+
+        // the values to update (on thread safe builds the setting is changed in
+        // the current thread only, so the handle gets values for each thread)
+        auto &values = ref->_slot < 0 ? ref->_values : local(ref->_slot);
+
+        // convert the new value
+        if (new_value) convert(values, ZSTR_VAL(new_value), ZSTR_LEN(new_value));
+        else convert(values, "", 0);
+
+        // done
+        return SUCCESS;
+    }
+};
+
+/**
+ *  The values in the table of the current thread (only on thread safe builds)
+ *  @return Values
+ */
+const IniRef::Values &IniRef::local() const
+{
+    // the values of this thread
+    auto &values = IniHandler::local(_slot);
+
+    // were they already set in this thread?
+    if (values.valid) return values;
+
+    // look up the setting of this thread
+    auto *entry = static_cast<zend_ini_entry *>(zend_hash_str_find_ptr(EG(ini_directives), _name.data(), _name.size()));
+
+    // convert the current value
+    if (entry && entry->value) IniHandler::convert(values, ZSTR_VAL(entry->value), ZSTR_LEN(entry->value));
+
+    // done
+    return values;
+}
+
 /**
  *  Filling ini_entries
  *  @param  zend_ini_entry *ini_entry, int module_number
@@ -22,17 +128,21 @@ void Ini::fill(zend_ini_entry_def *ini_entry, int module_number)
     ini_entry->modifiable       = static_cast<int>(_place);
     ini_entry->name             = _name.data();
     ini_entry->name_length      = _name.size();
-    ini_entry->on_modify        = OnUpdateString;
-    ini_entry->mh_arg1          = nullptr;
-    #ifdef ZTS
-        ini_entry->mh_arg2      = (void *) &phpcpp_globals_id;
-    #else
-        ini_entry->mh_arg2      = (void *) &phpcpp_globals;
-    #endif
+    ini_entry->on_modify        = &IniHandler::update;
+    ini_entry->mh_arg1          = _ref;
+    ini_entry->mh_arg2          = nullptr;
     ini_entry->mh_arg3          = nullptr;
     ini_entry->value            = _value.data();
     ini_entry->value_length     = _value.size();
     ini_entry->displayer        = nullptr;
+
+#ifdef ZTS
+    // on thread safe builds, every thread has its own settings, and the handle
+    // has to store the values in a table of each thread (a handle that is
+    // bound again after a reload keeps its place in the tables)
+    static int slots = 0;
+    if (_ref && _ref->_slot < 0) { _ref->_slot = slots++; _ref->_name = _name; }
+#endif
 }
 
 
@@ -0,0 +1,412 @@
+/**
+ *  MappedFile.cpp
+ *
+ *  Implementation file for the PhpCpp\MappedFile class
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  The class entry
+ *  @var zend_class_entry
+ */
+zend_class_entry *MappedFile::_entry = nullptr;
+
+/**
+ *  Copy a part of the mapping into a PHP string
+ *  @param  data        start of the part
+ *  @param  size        size of the part
+ *  @return Value
+ */
+static Value slice(const char *data, size_t size)
+{
+    // create the string
+    zval string;
+    ZVAL_STRINGL(&string, data, size);
+
+    // wrap it in a value (this does not copy the string again)
+    Value result(&string);
+
+    // the value holds its own reference
+    zval_ptr_dtor(&string);
+
+    // done
+    return result;
+}
+
+/**
+ *  Iterator over the lines of a mapped file
+ */
+class MappedFileIterator : public Iterator
+{
+private:
+    /**
+     *  The file
+     *  @var    MappedFile
+     */
+    const MappedFile *_file;
+
+    /**
+     *  Start and end of the current line
+     *  @var    size_t
+     */
+    size_t _start = 0;
+    size_t _end = 0;
+
+    /**
+     *  Number of the current line
+     *  @var    int64_t
+     */
+    int64_t _line = 0;
+
+    /**
+     *  Find the end of the line that starts at the current position
+     */
+    void scan()
+    {
+        // look for the next newline
+        auto *newline = (const char *)memchr(_file->data() + _start, '\n', _file->bytes() - _start);
+
+        // the line ends after the newline, or at the end of the file
+        _end = newline ? newline - _file->data() + 1 : _file->bytes();
+    }
+
+public:
+    /**
+     *  Constructor
+     *  @param  file        the file to iterate over
+     */
+    MappedFileIterator(MappedFile *file) : Iterator(file), _file(file) { if (valid()) scan(); }
+
+    /**
+     *  Destructor
+     */
+    virtual ~MappedFileIterator() = default;
+
+    /**
+     *  Is the iterator on a valid position
+     *  @return bool
+     */
+    virtual bool valid() override { return _start < _file->bytes(); }
+
+    /**
+     *  The current line
+     *  @return Value
+     */
+    virtual Value current() override { return slice(_file->data() + _start, _end - _start); }
+
+    /**
+     *  The number of the current line
+     *  @return Value
+     */
+    virtual Value key() override { return _line; }
+
+    /**
+     *  Move to the next line
+     */
+    virtual void next() override
+    {
+        // the next line starts where this one ends
+        _start = _end;
+        _line += 1;
+
+        // find its end
+        if (valid()) scan();
+    }
+
+    /**
+     *  Rewind the iterator to the first line
+     */
+    virtual void rewind() override
+    {
+        // start at the beginning
+        _start = 0;
+        _line = 0;
+
+        // find the end of the first line
+        if (valid()) scan();
+    }
+};
+
+/**
+ *  Destructor
+ */
+MappedFile::~MappedFile()
+{
+    // remove the mapping
+    unmap();
+}
+
+/**
+ *  PHP constructor
+ *  @param  params      the file name, or an open stream
+ */
+void MappedFile::__construct(Parameters &params)
+{
+    // the file to map
+    if (params.size() == 0) throw Exception("PhpCpp\\MappedFile expects a file name or a stream");
+
+    // is this an open stream?
+    if (params[0].type() == Type::Resource)
+    {
+        // the file descriptor of the stream
+        int fd = -1;
+
+        // get the file descriptor (this fails for resources that are not a stream)
+        try { fd = Stream(params[0]).fd(); } catch (const std::runtime_error &) { throw Exception("PhpCpp\\MappedFile expects a file name or a stream"); }
+
+        // not every stream has a file descriptor
+        if (fd < 0) throw Exception("PhpCpp\\MappedFile: stream has no file descriptor");
+
+        // map the file (the stream keeps ownership of the descriptor)
+        return map(fd);
+    }
+
+    // the name of the file
+    auto path = params[0].stringValue();
+
+    // the open_basedir setting also applies to mapped files (this reports a warning)
+    if (php_check_open_basedir(path.c_str())) throw Exception("PhpCpp\\MappedFile: " + path + " is not within the allowed path(s)");
+
+    // open the file
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    // check for failure
+    if (fd < 0) throw Exception("PhpCpp\\MappedFile: " + path + ": " + strerror(errno));
+
+    // the mapping stays valid after the file is closed
+    try { map(fd); } catch (...) { ::close(fd); throw; }
+
+    // close the file
+    ::close(fd);
+}
+
+/**
+ *  Map a file into memory
+ *  @param  fd          the file descriptor
+ */
+void MappedFile::map(int fd)
+{
+    // the constructor could be called more than once
+    unmap();
+
+    // find out the size of the file
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) throw Exception("PhpCpp\\MappedFile: not a regular file");
+
+    // empty files can not be mapped
+    if (info.st_size == 0) return;
+
+    // map the file
+    auto *data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // check for failure
+    if (data == MAP_FAILED) throw Exception(std::string("PhpCpp\\MappedFile: ") + strerror(errno));
+
+    // files are normally processed from the front to the back
+    madvise(data, info.st_size, MADV_SEQUENTIAL);
+
+    // store the mapping
+    _data = (const char *)data;
+    _size = info.st_size;
+}
+
+/**
+ *  Remove the mapping
+ */
+void MappedFile::unmap()
+{
+    // is there a mapping?
+    if (_data) munmap((void *)_data, _size);
+
+    // forget the mapping
+    _data = nullptr;
+    _size = 0;
+    _lines.clear();
+}
+
+/**
+ *  Find the offsets where the lines start
+ */
+void MappedFile::index()
+{
+    // leap out if the lines were already found
+    if (!_lines.empty() || _size == 0) return;
+
+    // the first line starts at the beginning
+    _lines.push_back(0);
+
+    // find all newlines
+    for (auto *newline = (const char *)memchr(_data, '\n', _size); newline; newline = (const char *)memchr(newline + 1, '\n', _data + _size - newline - 1))
+    {
+        // the next line starts after the newline (unless the file ends there)
+        if (newline + 1 < _data + _size) _lines.push_back(newline + 1 - _data);
+    }
+}
+
+/**
+ *  The number of lines in the file
+ *  @return Value
+ */
+Value MappedFile::lines()
+{
+    // find the lines
+    index();
+
+    // done
+    return (int64_t)_lines.size();
+}
+
+/**
+ *  Retrieve a line
+ *  @param  params      the line number
+ *  @return Value
+ */
+Value MappedFile::line(Parameters &params)
+{
+    // find the lines
+    index();
+
+    // the line number
+    int64_t number = params.empty() ? 0 : params[0].numericValue();
+
+    // does the line exist?
+    if (number < 0 || number >= (int64_t)_lines.size()) return nullptr;
+
+    // the line ends where the next one starts
+    size_t end = number + 1 < (int64_t)_lines.size() ? _lines[number + 1] : _size;
+
+    // copy the line
+    return slice(_data + _lines[number], end - _lines[number]);
+}
+
+/**
+ *  Retrieve a part of the file, just like substr() does
+ *  @param  params      the offset, and optionally the length
+ *  @return Value
+ */
+Value MappedFile::substr(Parameters &params) const
+{
+    // the offset, negative offsets count from the end
+    int64_t offset = params.empty() ? 0 : params[0].numericValue();
+    if (offset < 0) offset = std::max(offset + (int64_t)_size, (int64_t)0);
+    if (offset > (int64_t)_size) offset = _size;
+
+    // the length, negative lengths leave out bytes at the end
+    int64_t length = params.size() < 2 || params[1].isNull() ? (int64_t)_size - offset : params[1].numericValue();
+    if (length < 0) length = std::max(length + (int64_t)_size - offset, (int64_t)0);
+    if (length > (int64_t)_size - offset) length = _size - offset;
+
+    // copy the part
+    return slice(_data + offset, length);
+}
+
+/**
+ *  Does a byte exist?
+ *  @param  key
+ *  @return bool
+ */
+bool MappedFile::offsetExists(const Value &key)
+{
+    // check the range
+    int64_t offset = key.numericValue();
+    return offset >= 0 && offset < (int64_t)_size;
+}
+
+/**
+ *  Retrieve a byte
+ *  @param  key
+ *  @return Value
+ */
+Value MappedFile::offsetGet(const Value &key)
+{
+    // check the range
+    if (!offsetExists(key)) return nullptr;
+
+    // return the byte as a string
+    return _data[key.numericValue()];
+}
+
+/**
+ *  Mapped files are read-only
+ *  @param  key
+ *  @param  value
+ */
+void MappedFile::offsetSet(const Value &key, const Value &value)
+{
+    // report the error
+    throw Exception("PhpCpp\\MappedFile is read-only");
+}
+
+/**
+ *  Mapped files are read-only
+ *  @param  key
+ */
+void MappedFile::offsetUnset(const Value &key)
+{
+    // report the error
+    throw Exception("PhpCpp\\MappedFile is read-only");
+}
+
+/**
+ *  Retrieve an iterator over the lines of the file
+ *  @return Iterator
+ */
+Iterator *MappedFile::getIterator()
+{
+    // construct the iterator
+    return new MappedFileIterator(this);
+}
+
+/**
+ *  Initialize the class
+ */
+void MappedFile::initialize()
+{
+    // leap out if the class entry is already set
+    if (_entry) return;
+
+    // construct the class
+    static std::unique_ptr<Class<MappedFile>> mappedfile;
+
+    // the methods only have to be added once
+    if (!mappedfile)
+    {
+        // create the class
+        mappedfile.reset(new Class<MappedFile>("PhpCpp\\MappedFile"));
+
+        // add the methods
+        mappedfile->method<&MappedFile::__construct>("__construct", { ByVal("file") });
+        mappedfile->method<&MappedFile::size>("size");
+        mappedfile->method<&MappedFile::lines>("lines");
+        mappedfile->method<&MappedFile::line>("line", { ByVal("number", Type::Numeric) });
+        mappedfile->method<&MappedFile::substr>("substr", { ByVal("offset", Type::Numeric), ByVal("length", Type::Null, false) });
+    }
+
+    // initialize the class
+    _entry = mappedfile->implementation()->initialize(mappedfile.get(), "");
+}
+
+/**
+ *  Shutdown the class
+ */
+void MappedFile::shutdown()
+{
+    // we forget the entry
+    _entry = nullptr;
+}
+
+/**
+ *  End namespace
+ */
+}
@@ -0,0 +1,163 @@
+/**
+ *  MappedFile.h
+ *
+ *  The PhpCpp\MappedFile class that is exposed to PHP by the library. It
+ *  maps a file into memory (read-only), so that scripts can access bytes,
+ *  lines and slices of big files without reading the whole file into a PHP
+ *  string or array first:
+ *
+ *      $file = new PhpCpp\MappedFile("/var/log/big.log");
+ *      foreach ($file as $number => $line) { ... }
+ *      echo $file->line(10), $file->substr(100, 20), $file[0];
+ *
+ *  Only the lines and slices that are requested are copied into PHP strings.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class MappedFile : public Base, public ArrayAccess, public Countable, public Traversable
+{
+public:
+    /**
+     *  Constructor
+     */
+    MappedFile() = default;
+
+    /**
+     *  Mapped files can not be copied (and thus not be cloned), because the
+     *  copy would unmap the data of the original
+     *  @param  that
+     */
+    MappedFile(const MappedFile &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~MappedFile();
+
+    /**
+     *  PHP constructor
+     *  @param  params      the file name, or an open stream
+     */
+    void __construct(Parameters &params);
+
+    /**
+     *  The size of the file
+     *  @return Value
+     */
+    Value size() const { return (int64_t)_size; }
+
+    /**
+     *  The number of lines in the file
+     *  @return Value
+     */
+    Value lines();
+
+    /**
+     *  Retrieve a line (counting from zero, the line ending is included)
+     *  @param  params      the line number
+     *  @return Value
+     */
+    Value line(Parameters &params);
+
+    /**
+     *  Retrieve a part of the file, just like substr() does
+     *  @param  params      the offset, and optionally the length
+     *  @return Value
+     */
+    Value substr(Parameters &params) const;
+
+    /**
+     *  The number of bytes in the file
+     *  @return long
+     */
+    virtual long count() override { return _size; }
+
+    /**
+     *  Methods to access the bytes of the file
+     *  @param  key
+     *  @param  value
+     *  @return mixed
+     */
+    virtual bool offsetExists(const Value &key) override;
+    virtual Value offsetGet(const Value &key) override;
+    virtual void offsetSet(const Value &key, const Value &value) override;
+    virtual void offsetUnset(const Value &key) override;
+
+    /**
+     *  Retrieve an iterator over the lines of the file
+     *  @return Iterator
+     */
+    virtual Iterator *getIterator() override;
+
+    /**
+     *  The mapped data and its size
+     *  @return const char *
+     */
+    const char *data() const { return _data; }
+    size_t bytes() const { return _size; }
+
+    /**
+     *  Initialize the class
+     */
+    static void initialize();
+
+    /**
+     *  Shutdown the class
+     */
+    static void shutdown();
+
+private:
+    /**
+     *  The mapped data
+     *  @var    const char *
+     */
+    const char *_data = nullptr;
+
+    /**
+     *  Size of the mapped data
+     *  @var    size_t
+     */
+    size_t _size = 0;
+
+    /**
+     *  Offsets where the lines start (only filled when lines are accessed by number)
+     *  @var    std::vector<size_t>
+     */
+    std::vector<size_t> _lines;
+
+    /**
+     *  The class entry
+     *  @var    zend_class_entry
+     */
+    static zend_class_entry *_entry;
+
+    /**
+     *  Map a file into memory
+     *  @param  fd          the file descriptor
+     */
+    void map(int fd);
+
+    /**
+     *  Remove the mapping
+     */
+    void unmap();
+
+    /**
+     *  Find the offsets where the lines start
+     */
+    void index();
+};
+
+/**
+ *  End namespace
+ */
+}
@@ -37,26 +37,26 @@ public:
      *  @param  flags           Access flags
      *  @param  args            Argument description
      */
-    Method(const char *name, const method_callback_0 &callback, int flags, const Arguments &args) : Callable(name, args), _type(0),    _flags(flags) { _callback.m0  = callback; }
-    Method(const char *name, const method_callback_1 &callback, int flags, const Arguments &args) : Callable(name, args), _type(1),    _flags(flags) { _callback.m1  = callback; }
-    Method(const char *name, const method_callback_2 &callback, int flags, const Arguments &args) : Callable(name, args), _type(2),    _flags(flags) { _callback.m2  = callback; }
-    Method(const char *name, const method_callback_3 &callback, int flags, const Arguments &args) : Callable(name, args), _type(3),    _flags(flags) { _callback.m3  = callback; }
-    Method(const char *name, const method_callback_4 &callback, int flags, const Arguments &args) : Callable(name, args), _type(4),    _flags(flags) { _callback.m4  = callback; }
-    Method(const char *name, const method_callback_5 &callback, int flags, const Arguments &args) : Callable(name, args), _type(5),    _flags(flags) { _callback.m5  = callback; }
-    Method(const char *name, const method_callback_6 &callback, int flags, const Arguments &args) : Callable(name, args), _type(6),    _flags(flags) { _callback.m6  = callback; }
-    Method(const char *name, const method_callback_7 &callback, int flags, const Arguments &args) : Callable(name, args), _type(7),    _flags(flags) { _callback.m7  = callback; }
-    Method(const char *name, const native_callback_0 &callback, int flags, const Arguments &args) : Callable(name, args), _type(8),    _flags(flags) { _callback.m8  = callback; }
-    Method(const char *name, const native_callback_1 &callback, int flags, const Arguments &args) : Callable(name, args), _type(9),    _flags(flags) { _callback.m9  = callback; }
-    Method(const char *name, const native_callback_2 &callback, int flags, const Arguments &args) : Callable(name, args), _type(10),   _flags(flags) { _callback.m10 = callback; }
-    Method(const char *name, const native_callback_3 &callback, int flags, const Arguments &args) : Callable(name, args), _type(11),   _flags(flags) { _callback.m11 = callback; }
+    Method(const char *name, const method_callback_0 &callback, int flags, const Arguments &args) : Callable(name, args), _type(0),    _flags(flags) { _callback.m0  = callback; _handler = &Callable::invoke<Method, &Method::call0>; }
+    Method(const char *name, const method_callback_1 &callback, int flags, const Arguments &args) : Callable(name, args), _type(1),    _flags(flags) { _callback.m1  = callback; _handler = &Callable::invoke<Method, &Method::call1>; }
+    Method(const char *name, const method_callback_2 &callback, int flags, const Arguments &args) : Callable(name, args), _type(2),    _flags(flags) { _callback.m2  = callback; _handler = &Callable::invoke<Method, &Method::call2>; }
+    Method(const char *name, const method_callback_3 &callback, int flags, const Arguments &args) : Callable(name, args), _type(3),    _flags(flags) { _callback.m3  = callback; _handler = &Callable::invoke<Method, &Method::call3>; }
+    Method(const char *name, const method_callback_4 &callback, int flags, const Arguments &args) : Callable(name, args), _type(4),    _flags(flags) { _callback.m4  = callback; _handler = &Callable::invoke<Method, &Method::call4>; }
+    Method(const char *name, const method_callback_5 &callback, int flags, const Arguments &args) : Callable(name, args), _type(5),    _flags(flags) { _callback.m5  = callback; _handler = &Callable::invoke<Method, &Method::call5>; }
+    Method(const char *name, const method_callback_6 &callback, int flags, const Arguments &args) : Callable(name, args), _type(6),    _flags(flags) { _callback.m6  = callback; _handler = &Callable::invoke<Method, &Method::call6>; }
+    Method(const char *name, const method_callback_7 &callback, int flags, const Arguments &args) : Callable(name, args), _type(7),    _flags(flags) { _callback.m7  = callback; _handler = &Callable::invoke<Method, &Method::call7>; }
+    Method(const char *name, const native_callback_0 &callback, int flags, const Arguments &args) : Callable(name, args), _type(8),    _flags(flags) { _callback.m8  = callback; _handler = &Callable::invoke<Method, &Method::call8>; }
+    Method(const char *name, const native_callback_1 &callback, int flags, const Arguments &args) : Callable(name, args), _type(9),    _flags(flags) { _callback.m9  = callback; _handler = &Callable::invoke<Method, &Method::call9>; }
+    Method(const char *name, const native_callback_2 &callback, int flags, const Arguments &args) : Callable(name, args), _type(10),   _flags(flags) { _callback.m10 = callback; _handler = &Callable::invoke<Method, &Method::call10>; }
+    Method(const char *name, const native_callback_3 &callback, int flags, const Arguments &args) : Callable(name, args), _type(11),   _flags(flags) { _callback.m11 = callback; _handler = &Callable::invoke<Method, &Method::call11>; }
     Method(const char *name,                                    int flags, const Arguments &args) : Callable(name, args), _type(9999), _flags(flags) { _callback.m0 = nullptr;  }
 
     /**
      *  Copy and move constructors
      *  @param  that
      */
-    Method(const Method &that) : Callable(that), _type(that._type), _flags(that._flags), _callback(that._callback) {}
-    Method(Method &&that) : Callable(std::move(that)), _type(that._type), _flags(that._flags), _callback(that._callback) {}
+    Method(const Method &that) : Callable(that), _type(that._type), _flags(that._flags), _mutating(that._mutating), _callback(that._callback) {}
+    Method(Method &&that) : Callable(std::move(that)), _type(that._type), _flags(that._flags), _mutating(that._mutating), _callback(that._callback) {}
 
     /**
      *  Destructor
@@ -78,6 +78,22 @@ public:
         Callable::initialize(entry, classname.c_str(), _flags);
     }
 
+    /**
+     *  Mark the method as one that modifies the object (Php::Mutating)
+     */
+    void mutating() { _mutating = true; }
+
+    /**
+     *  Does a function that was registered by PHP-CPP modify the object?
+     *  @param  function    The function that is called
+     *  @return bool
+     */
+    static bool mutates(const zend_function *function)
+    {
+        // the method is found without a lookup
+        return static_cast<Method*>(lookup(function))->_mutating;
+    }
+
     /**
      *  Invoke the method
      *  @param  parameters
@@ -108,6 +124,26 @@ public:
 
 
 private:
+    /**
+     *  Static functions that call one specific type of callback, these are
+     *  used by the handlers that the Zend engine calls directly
+     *  @param  self        The method that is called
+     *  @param  params      The parameters that were passed
+     *  @return Value
+     */
+    static Value call0(Method *self, Parameters &params)  { (params.object()->*self->_callback.m0)(); return Value(); }
+    static Value call1(Method *self, Parameters &params)  { (params.object()->*self->_callback.m1)(params); return Value(); }
+    static Value call2(Method *self, Parameters &params)  { return (params.object()->*self->_callback.m2)(); }
+    static Value call3(Method *self, Parameters &params)  { return (params.object()->*self->_callback.m3)(params); }
+    static Value call4(Method *self, Parameters &params)  { (params.object()->*self->_callback.m4)(); return Value(); }
+    static Value call5(Method *self, Parameters &params)  { (params.object()->*self->_callback.m5)(params); return Value(); }
+    static Value call6(Method *self, Parameters &params)  { return (params.object()->*self->_callback.m6)(); }
+    static Value call7(Method *self, Parameters &params)  { return (params.object()->*self->_callback.m7)(params); }
+    static Value call8(Method *self, Parameters &params)  { self->_callback.m8(); return Value(); }
+    static Value call9(Method *self, Parameters &params)  { self->_callback.m9(params); return Value(); }
+    static Value call10(Method *self, Parameters &params) { return self->_callback.m10(); }
+    static Value call11(Method *self, Parameters &params) { return self->_callback.m11(params); }
+
     /**
      *  Callback type
      *  @var int
@@ -119,6 +155,12 @@ private:
      *  @var int
      */
     int _flags;
+
+    /**
+     *  Was the method registered with the Php::Mutating flag?
+     *  @var bool
+     */
+    bool _mutating = false;
     
     /**
      *  The actual callback
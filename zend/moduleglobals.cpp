@@ -0,0 +1,59 @@
+/**
+ *  ModuleGlobals.cpp
+ *
+ *  Implementation file for the module globals of an extension
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Constructor
+ *  @param  size        Size of the struct
+ *  @param  construct   Function to construct the struct
+ *  @param  destruct    Function to destruct the struct
+ *  @param  reset       Should the struct be constructed again after each request?
+ */
+ModuleGlobalsBase::ModuleGlobalsBase(size_t size, Function construct, Function destruct, bool reset) :
+    _size(size), _construct(construct), _destruct(destruct), _reset(reset)
+{
+#ifndef ZTS
+    // on regular builds there is only one struct, the Zend engine constructs
+    // it in this memory when the module is registered
+    _data = ::operator new(size);
+#endif
+}
+
+/**
+ *  Destructor
+ */
+ModuleGlobalsBase::~ModuleGlobalsBase()
+{
+    // the struct was already destructed by the Zend engine, only the memory is left
+    ::operator delete(_data);
+}
+
+/**
+ *  Find the struct of the current thread
+ *  @return void*
+ */
+void *ModuleGlobalsBase::lookup() const
+{
+#ifdef ZTS
+    // the struct is stored in the resource table of the thread
+    return TSRMG_BULK(_id, void *);
+#else
+    // the memory is always set on regular builds
+    return _data;
+#endif
+}
+
+/**
+ *  End namespace
+ */
+}
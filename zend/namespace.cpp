@@ -13,6 +13,29 @@
  */
 namespace Php {
 
+/**
+ *  Helper function to prepend the name of a namespace to a name
+ *  @param  ns          Name of the namespace (may be empty)
+ *  @param  name        The name
+ *  @return std::string
+ */
+static std::string qualify(const std::string &ns, const std::string &name)
+{
+    // the root namespace does not change the name
+    if (ns.empty()) return name;
+
+    // the name of the namespace itself
+    if (name.empty()) return ns;
+
+    // construct the full name
+    std::string result;
+    result.reserve(ns.size() + 1 + name.size());
+    result.append(ns).append(1, '\\').append(name);
+
+    // done
+    return result;
+}
+
 /**
  *  Add a native function directly to the namespace
  *
@@ -26,8 +49,8 @@ Namespace &Namespace::add(const char *name, ZendCallback function, const Argumen
     // skip when locked
     if (locked()) return *this;
 
-    // add a function
-    _functions.push_back(std::make_shared<NativeFunction>(name, function, arguments));
+    // add a function (with its fully qualified name)
+    _functions.push_back(std::make_shared<NativeFunction>(qualify(_name, name).data(), function, arguments));
 
     // allow chaining
     return *this;
@@ -45,8 +68,8 @@ Namespace &Namespace::add(const char *name, const native_callback_0 &function, c
     // skip when locked
     if (locked()) return *this;
 
-    // add a function
-    _functions.push_back(std::make_shared<NativeFunction>(name, function, arguments));
+    // add a function (with its fully qualified name)
+    _functions.push_back(std::make_shared<NativeFunction>(qualify(_name, name).data(), function, arguments));
     
     // allow chaining
     return *this;
@@ -64,8 +87,8 @@ Namespace &Namespace::add(const char *name, const native_callback_1 &function, c
     // skip when locked
     if (locked()) return *this;
 
-    // add a function
-    _functions.push_back(std::make_shared<NativeFunction>(name, function, arguments));
+    // add a function (with its fully qualified name)
+    _functions.push_back(std::make_shared<NativeFunction>(qualify(_name, name).data(), function, arguments));
 
     // allow chaining
     return *this;
@@ -83,8 +106,8 @@ Namespace &Namespace::add(const char *name, const native_callback_2 &function, c
     // skip when locked
     if (locked()) return *this;
 
-    // add a function
-    _functions.push_back(std::make_shared<NativeFunction>(name, function, arguments));
+    // add a function (with its fully qualified name)
+    _functions.push_back(std::make_shared<NativeFunction>(qualify(_name, name).data(), function, arguments));
 
     // allow chaining
     return *this;
@@ -102,13 +125,45 @@ Namespace &Namespace::add(const char *name, const native_callback_3 &function, c
     // skip when locked
     if (locked()) return *this;
 
-    // add a function
-    _functions.push_back(std::make_shared<NativeFunction>(name, function, arguments));
+    // add a function (with its fully qualified name)
+    _functions.push_back(std::make_shared<NativeFunction>(qualify(_name, name).data(), function, arguments));
 
     // allow chaining
     return *this;
 }
 
+/**
+ *  Add the elements of a nested namespace to this namespace
+ *  @param  ns          The nested namespace
+ *  @param  copy        Should the functions be copied (because they are still used by the nested namespace)
+ */
+void Namespace::absorb(const Namespace &ns, bool copy)
+{
+    // make room for the new elements
+    _functions.reserve(_functions.size() + ns._functions.size());
+    _classes.reserve(_classes.size() + ns._classes.size());
+    _constants.reserve(_constants.size() + ns._constants.size());
+    _tables.reserve(_tables.size() + ns._tables.size());
+
+    // the names of the functions are already qualified with the nested namespace
+    for (auto &function : ns._functions)
+    {
+        // the function may have to be copied, because its name is changed
+        auto result = copy ? std::make_shared<NativeFunction>(*function) : function;
+
+        // prepend our own name
+        if (!_name.empty()) result->qualify(_name);
+
+        // add the function
+        _functions.push_back(std::move(result));
+    }
+
+    // the other elements are stored with the name of their namespace
+    for (auto &c : ns._classes) _classes.emplace_back(qualify(_name, c.first), c.second);
+    for (auto &c : ns._constants) _constants.emplace_back(qualify(_name, c.first), c.second);
+    for (auto &table : ns._tables) _tables.push_back(Table{ qualify(_name, table.prefix), table.entries, table.count });
+}
+
 /**
  *  Apply a callback to each registered function
  * 
@@ -119,19 +174,8 @@ Namespace &Namespace::add(const char *name, const native_callback_3 &function, c
  */
 void Namespace::functions(const std::function<void(const std::string &ns, NativeFunction &func)> &callback)
 {
-    // loop through the functions, and apply the callback
+    // the names of the functions are fully qualified
     for (auto &function : _functions) callback(_name, *function);
-    
-    // loop through the other namespaces
-    for (auto &ns : _namespaces) ns->functions([this, callback](const std::string &ns, NativeFunction &func) {
-        
-        // if this is the root namespace, we don't have to change the prefix
-        if (_name.size() == 0) return callback(ns, func);
-        
-        // construct a new prefix
-        // @todo this could be slightly inefficient
-        return callback(_name + "\\" + ns, func);
-    });
 }
 
 /**
@@ -144,19 +188,8 @@ void Namespace::functions(const std::function<void(const std::string &ns, Native
  */
 void Namespace::classes(const std::function<void(const std::string &ns, ClassBase &clss)> &callback)
 {
-    // loop through the classes, and apply the callback
-    for (auto &c : _classes) callback(_name, *c);
-    
-    // loop through the other namespaces
-    for (auto &ns : _namespaces) ns->classes([this, callback](const std::string &ns, ClassBase &clss) {
-        
-        // if this is the root namespace, we don't have to change the prefix
-        if (_name.size() == 0) return callback(ns, clss);
-        
-        // construct a new prefix
-        // @todo this could be slightly inefficient
-        return callback(_name + "\\" + ns, clss);
-    });
+    // the classes of nested namespaces are stored here too
+    for (auto &c : _classes) callback(c.first, *c.second);
 }
 
 /**
@@ -169,19 +202,22 @@ void Namespace::classes(const std::function<void(const std::string &ns, ClassBas
  */
 void Namespace::constants(const std::function<void(const std::string &ns, Constant &constant)> &callback)
 {
-    // loop through the constants, and apply the callback
-    for (auto &c : _constants) callback(_name, *c);
-    
-    // loop through the other namespaces
-    for (auto &ns : _namespaces) ns->constants([this, callback](const std::string &ns, Constant &constant) {
-        
-        // if this is the root namespace, we don't have to change the prefix
-        if (_name.size() == 0) return callback(ns, constant);
-        
-        // construct a new prefix
-        // @todo this could be slightly inefficient
-        return callback(_name + "\\" + ns, constant);
-    });
+    // the constants of nested namespaces are stored here too
+    for (auto &c : _constants) callback(c.first, *c.second);
+}
+
+/**
+ *  Apply a callback to each static table of constants
+ *
+ *  The callback will be called with the name of the namespace, and
+ *  the entries and size of the table
+ *
+ *  @param  callback
+ */
+void Namespace::tables(const std::function<void(const std::string &ns, const ConstantEntry *entries, size_t count)> &callback)
+{
+    // the tables of nested namespaces are stored here too
+    for (auto &table : _tables) callback(table.prefix, table.entries, table.count);
 }
 
 /**
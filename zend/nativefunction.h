@@ -32,10 +32,10 @@ public:
      *  @param  name            Function name
      *  @param  function        The native C function
      */
-    NativeFunction(const char *name, const native_callback_0 &function, const Arguments &arguments = {}) : Callable(name, arguments), _type(0) { _function.f0 = function; }
-    NativeFunction(const char *name, const native_callback_1 &function, const Arguments &arguments = {}) : Callable(name, arguments), _type(1) { _function.f1 = function; }
-    NativeFunction(const char *name, const native_callback_2 &function, const Arguments &arguments = {}) : Callable(name, arguments), _type(2) { _function.f2 = function; }
-    NativeFunction(const char *name, const native_callback_3 &function, const Arguments &arguments = {}) : Callable(name, arguments), _type(3) { _function.f3 = function; }
+    NativeFunction(const char *name, const native_callback_0 &function, const Arguments &arguments = {}) : Callable(name, arguments), _type(0) { _function.f0 = function; _handler = &Callable::invoke<NativeFunction, &NativeFunction::call0>; }
+    NativeFunction(const char *name, const native_callback_1 &function, const Arguments &arguments = {}) : Callable(name, arguments), _type(1) { _function.f1 = function; _handler = &Callable::invoke<NativeFunction, &NativeFunction::call1>; }
+    NativeFunction(const char *name, const native_callback_2 &function, const Arguments &arguments = {}) : Callable(name, arguments), _type(2) { _function.f2 = function; _handler = &Callable::invoke<NativeFunction, &NativeFunction::call2>; }
+    NativeFunction(const char *name, const native_callback_3 &function, const Arguments &arguments = {}) : Callable(name, arguments), _type(3) { _function.f3 = function; _handler = &Callable::invoke<NativeFunction, &NativeFunction::call3>; }
 
     /**
      *  Copy constructor
@@ -70,21 +70,39 @@ public:
         }
     }
 
+    /**
+     *  Prepend the name of a namespace to the name of the function
+     *  @param  ns          Name of the namespace
+     */
+    void qualify(const std::string &ns)
+    {
+        // construct the fully qualified name
+        _name.insert(0, 1, '\\').insert(0, ns);
+    }
+
     /**
      *  Fill a function entry
-     *  @param  prefix      Active namespace prefix
      *  @param  entry       Entry to be filled
      */
-    void initialize(const std::string &prefix, zend_function_entry *entry)
+    void initialize(zend_function_entry *entry)
     {
-        // if there is a namespace prefix, we should adjust the name
-        if (!prefix.empty()) _name = prefix + '\\' + _name;
-
-        // call base initialize
+        // call base initialize (the name is already fully qualified)
         Callable::initialize(entry);
     }
 
 private:
+    /**
+     *  Static functions that call one specific type of callback, these are
+     *  used by the handlers that the Zend engine calls directly
+     *  @param  self        The function that is called
+     *  @param  params      The parameters that were passed
+     *  @return Value
+     */
+    static Value call0(NativeFunction *self, Parameters &params) { self->_function.f0(); return Value(); }
+    static Value call1(NativeFunction *self, Parameters &params) { self->_function.f1(params); return Value(); }
+    static Value call2(NativeFunction *self, Parameters &params) { return self->_function.f2(); }
+    static Value call3(NativeFunction *self, Parameters &params) { return self->_function.f3(params); }
+
     /**
      *  Union of supported callbacks
      *  One of the callbacks will be set
@@ -75,6 +75,40 @@ Object::Object(zend_class_entry *entry, Base *base) : Value()
     }
 }
 
+/**
+ *  Constructor for a class that is referred to by a handle
+ *
+ *  @param  classref    The class to instantiate
+ *  @param  base        The C++ object to wrap
+ */
+Object::Object(const ClassRef &classref, Base *base) : Value()
+{
+    // does the object already have a handle?
+    if (base->implementation())
+    {
+        // the object is already instantiated, we can assign it to this object
+        operator=(Value(base));
+    }
+    else
+    {
+        // find the class entry
+        auto *entry = classref.entry();
+        if (!entry) throw Error("Unknown class name " + classref.name());
+
+        // construct an implementation (this will also set the implementation
+        // member in the base object), this is a self-destructing object that
+        // will be destructed when the last reference to it has been removed,
+        // we already set the reference to zero
+        new ObjectImpl(entry, base, ClassImpl::objectHandlers(entry), 0);
+
+        // now we can store it
+        operator=(Value(base));
+
+        // install the object handlers
+        Z_OBJ_P(_val)->handlers = ClassImpl::objectHandlers(entry);
+    }
+}
+
 /**
  *  Copy constructor is valid if the passed in object is also an object,
  *  or when it is a string holding a classname
@@ -107,6 +141,32 @@ bool Object::instantiate(const char *name)
     auto *entry = zend_fetch_class(String{ name }, ZEND_FETCH_CLASS_SILENT);
     if (!entry) throw Error(std::string("Unknown class name ") + name);
 
+    // instantiate the class
+    return instantiate(entry);
+}
+
+/**
+ *  Internal method to instantiate an object of a class that is referred to by a handle
+ *  @param  classref    The class to instantiate
+ *  @return bool        True if there is a __construct function
+ */
+bool Object::instantiate(const ClassRef &classref)
+{
+    // find the class entry (this is only looked up once per request)
+    auto *entry = classref.entry();
+    if (!entry) throw Error("Unknown class name " + classref.name());
+
+    // instantiate the class
+    return instantiate(entry);
+}
+
+/**
+ *  Internal method to instantiate an object of a class
+ *  @param  entry       The class entry
+ *  @return bool        True if there is a __construct function
+ */
+bool Object::instantiate(zend_class_entry *entry)
+{
     // initiate the zval (which was already allocated in the base constructor)
     object_init_ex(_val, entry);
 
@@ -47,19 +47,62 @@ private:
      */
     std::unique_ptr<Base> _object;
 
-public:
     /**
-     *  Constructor
-     *
-     *  This will create a new object in the Zend engine.
+     *  Pointer to the C++ implementation when it is shared with clones (this
+     *  is only used for classes that are copied on write)
+     *  @var    std::shared_ptr<Base>
+     */
+    std::shared_ptr<Base> _shared;
+
+    /**
+     *  Is this a clone that did not yet get its own copy of the C++ object?
+     *  @var    bool
+     */
+    bool _clone = false;
+
+    /**
+     *  Was the destructor of the PHP object already called?
+     *  @var    bool
+     */
+    bool _destructed = false;
+
+    /**
+     *  The other objects that share the C++ object (a circular list, the
+     *  object points to itself when it does not share)
+     *  @var    ObjectImpl
+     */
+    ObjectImpl *_prev = this;
+    ObjectImpl *_next = this;
+
+    /**
+     *  Leave the list of objects that share the C++ object
+     *  @return ObjectImpl  The object that is left as the only owner (if any)
+     */
+    ObjectImpl *leave()
+    {
+        // leap out if we did not share
+        if (_next == this) return nullptr;
+
+        // the object that comes after us
+        auto *other = _next;
+
+        // remove ourselves from the list
+        _prev->_next = _next;
+        _next->_prev = _prev;
+        _prev = _next = this;
+
+        // is the other object now on its own?
+        return other->_next == other ? other : nullptr;
+    }
+
+    /**
+     *  Helper method to allocate and initialize the zend_object
      *
      *  @param  entry       Zend class entry
      *  @param  handler     Zend object handlers
-     *  @param  base        C++ object that already exists
      *  @param  refcount    The initial refcount for the object
      */
-    ObjectImpl(zend_class_entry *entry, Base *base, zend_object_handlers *handlers, int refcount) :
-        _object(base)
+    void initialize(zend_class_entry *entry, zend_object_handlers *handlers, int refcount)
     {
         // allocate a mixed object (for some reason this does not have to be deallocated)
         _mixed = (MixedObject *)ecalloc(1, sizeof(MixedObject) + zend_object_properties_size(entry));
@@ -81,15 +124,68 @@ public:
         // set the initial refcount (if it is different than one, because one is the default)
         if (refcount != 1) GC_SET_REFCOUNT(php(),refcount);
 #endif
+    }
+
+public:
+    /**
+     *  Constructor
+     *
+     *  This will create a new object in the Zend engine.
+     *
+     *  @param  entry       Zend class entry
+     *  @param  handler     Zend object handlers
+     *  @param  base        C++ object that already exists
+     *  @param  refcount    The initial refcount for the object
+     */
+    ObjectImpl(zend_class_entry *entry, Base *base, zend_object_handlers *handlers, int refcount) :
+        _object(base)
+    {
+        // create the zend object
+        initialize(entry, handlers, refcount);
+
         // the object may remember that we are its implementation object
         base->_impl = this;
     }
 
+    /**
+     *  Constructor for a clone that shares the C++ object with the original
+     *
+     *  @param  entry       Zend class entry
+     *  @param  original    The object that is cloned
+     *  @param  handler     Zend object handlers
+     *  @param  refcount    The initial refcount for the object
+     */
+    ObjectImpl(zend_class_entry *entry, ObjectImpl *original, zend_object_handlers *handlers, int refcount) :
+        _shared(original->share()), _clone(true), _prev(original), _next(original->_next)
+    {
+        // create the zend object
+        initialize(entry, handlers, refcount);
+
+        // join the list of objects that share the C++ object
+        _prev->_next = this;
+        _next->_prev = this;
+    }
+
     /**
      *  Destructor
      */
     virtual ~ObjectImpl()
     {
+        // is the C++ object shared?
+        if (_shared)
+        {
+            // the shared C++ object should no longer refer to us
+            if (_shared->_impl == this) _shared->_impl = nullptr;
+
+            // stop sharing
+            auto *remaining = leave();
+            _shared.reset();
+
+            // an object that is now the only owner takes over the C++ object
+            if (remaining) ClassImpl::adopt(remaining);
+        }
+
+        // destruct the zend object
         zend_object_std_dtor(&_mixed->php);
     }
 
@@ -149,7 +245,139 @@ public:
      */
     Base *object() const
     {
-        return _object.get();
+        // in most cases the object is not shared
+        if (!_shared) return _object.get();
+
+        // the shared object has to know on behalf of which PHP object it is used
+        _shared->_impl = const_cast<ObjectImpl*>(this);
+
+        // expose the shared object
+        return _shared.get();
+    }
+
+    /**
+     *  Retrieve the C++ object to call a function on, the object is first
+     *  copied if it is shared and the function is going to modify it
+     *  @param  function    The function that is going to be called
+     *  @return Base
+     */
+    Base *object(const zend_function *function)
+    {
+        // make a private copy if the function modifies a shared object
+        return shared() && ClassImpl::mutates(function) ? ClassImpl::detach(this) : object();
+    }
+
+    /**
+     *  Retrieve the C++ object because it is going to be modified, the object
+     *  is first copied if it is shared with other instances
+     *  @return Base
+     */
+    Base *writable()
+    {
+        // make a private copy if the object is shared
+        return shared() ? ClassImpl::detach(this) : object();
+    }
+
+    /**
+     *  Is the C++ object shared with other instances?
+     *  @return bool
+     */
+    bool shared() const
+    {
+        return _shared && _shared.use_count() > 1;
+    }
+
+    /**
+     *  Is this a clone that still shares the C++ object of the original?
+     *  @return bool
+     */
+    bool clone() const
+    {
+        return _clone;
+    }
+
+    /**
+     *  Called when the destructor of the PHP object runs, this returns true
+     *  if the C++ object should be destructed too: when it is not shared, or
+     *  when the other objects that share it have already been destructed
+     *  @return bool
+     */
+    bool destructing()
+    {
+        // remember that this object is destructed
+        _destructed = true;
+
+        // check the other objects that share the C++ object
+        for (auto *other = _next; other != this; other = other->_next) if (!other->_destructed) return false;
+
+        // we are the last one
+        return true;
+    }
+
+    /**
+     *  Was the destructor of the PHP object already called?
+     *  @return bool
+     */
+    bool destructed() const
+    {
+        return _destructed;
+    }
+
+    /**
+     *  Become the only owner of the shared C++ object
+     *  @return bool        Should the postponed magic __clone method be called?
+     */
+    bool adopt()
+    {
+        // the C++ object may remember that we are its implementation object
+        _shared->_impl = this;
+
+        // the magic __clone is only useful when the object is still alive
+        bool clone = _clone && !_destructed;
+
+        // we are no longer a clone that waits for its copy
+        _clone = false;
+
+        // done
+        return clone;
+    }
+
+    /**
+     *  Share the C++ object, so that it can be passed to a clone
+     *  @return std::shared_ptr<Base>
+     */
+    const std::shared_ptr<Base> &share()
+    {
+        // move the object to shared ownership
+        if (!_shared) _shared.reset(_object.release());
+
+        // expose the shared object
+        return _shared;
+    }
+
+    /**
+     *  Stop sharing the C++ object, and install a private copy
+     *  @param  copy        The private copy of the C++ object
+     *  @return ObjectImpl  The object that is left as the only owner of the shared object (if any)
+     */
+    ObjectImpl *detach(Base *copy)
+    {
+        // the shared object should no longer refer to us
+        if (_shared->_impl == this) _shared->_impl = nullptr;
+
+        // forget the shared object
+        auto *remaining = leave();
+        _shared.reset();
+        _clone = false;
+
+        // from now on we use the copy
+        _object.reset(copy);
+
+        // the copy may remember that we are its implementation object
+        copy->_impl = this;
+
+        // expose the object that keeps the shared object
+        return remaining;
     }
 
     /**
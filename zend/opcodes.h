@@ -55,15 +55,44 @@ public:
         return _opcodes != nullptr;
     }
 
+    /**
+     *  The compiled op array
+     *  @return zend_op_array
+     */
+    const struct _zend_op_array *opcodes() const
+    {
+        return _opcodes;
+    }
+
     /**
      *  Execute the opcodes
+     *  @param  symbols     Optional variables of an isolated scope
      *  @return Value
      */
-    Value execute() const
+    Value execute(zend_array *symbols = nullptr) const
     {
         // if the script could not be compiled, we return null
         if (!_opcodes) return nullptr;
 
+        // execute the opcodes
+        return execute(_opcodes, symbols);
+    }
+
+    /**
+     *  Execute a set of opcodes that is not owned by an Opcodes object
+     *
+     *  Without a symbol table, the script runs in the scope of the calling
+     *  function (whose symbol table is built if it does not yet have one).
+     *  With a symbol table, the script runs in an isolated scope that holds
+     *  just the variables in the table: the variables are bound to the script
+     *  in one go when it starts, and written back when it ends.
+     *
+     *  @param  opcodes
+     *  @param  symbols     Optional variables of an isolated scope
+     *  @return Value
+     */
+    static Value execute(struct _zend_op_array *opcodes, zend_array *symbols = nullptr)
+    {
         // pointer that is going to hold the return value of the script
         zval retval;
 
@@ -77,15 +106,15 @@ public:
 
         // old execute state has been saved (and will automatically be restored when
         // the oldstate is destructed), so we can now safely overwrite all the settings
-        CG(active_op_array) = _opcodes;
+        CG(active_op_array) = opcodes;
         EG(no_extensions) = 1;
-        if (!EG(current_execute_data)->symbol_table) zend_rebuild_symbol_table();
 
         // the current exception state
         State state;
 
-        // execute the code
-        zend_execute(_opcodes, &retval);
+        // execute the code in the scope of the caller or in an isolated scope
+        if (symbols) isolated(opcodes, symbols, &retval);
+        else shared(opcodes, &retval);
 
         // was an exception thrown inside the eval()'ed code? In that case we
         // throw a C++ new exception to give the C++ code the chance to catch it
@@ -102,6 +131,52 @@ public:
     }
 
 private:
+    /**
+     *  Execute the opcodes in the scope of the calling function
+     *  @param  opcodes
+     *  @param  retval      Zval for the return value
+     */
+    static void shared(struct _zend_op_array *opcodes, zval *retval)
+    {
+        // the variables of the caller must be available in a symbol table
+        if (!EG(current_execute_data)->symbol_table) zend_rebuild_symbol_table();
+
+        // execute the code
+        zend_execute(opcodes, retval);
+    }
+
+    /**
+     *  Execute the opcodes in an isolated scope, this is what zend_execute()
+     *  does, but with our own symbol table instead of the one of the caller
+     *  @param  opcodes
+     *  @param  symbols     The variables of the scope
+     *  @param  retval      Zval for the return value
+     */
+    static void isolated(struct _zend_op_array *opcodes, zend_array *symbols, zval *retval)
+    {
+        // the flags of the stack frame: top level code that has a symbol table
+        uint32_t flags = ZEND_CALL_TOP_CODE | ZEND_CALL_HAS_SYMBOL_TABLE;
+
+        // create the stack frame, there is no $this and no class scope
+#if PHP_VERSION_ID < 70400
+        zend_execute_data *frame = zend_vm_stack_push_call_frame(flags, (zend_function *)opcodes, 0, nullptr, nullptr);
+#else
+        zend_execute_data *frame = zend_vm_stack_push_call_frame(flags, (zend_function *)opcodes, 0, nullptr);
+#endif
+
+        // use the variables of the scope
+        frame->symbol_table = symbols;
+
+        // initialize the frame, this binds all variables from the symbol table
+        zend_init_code_execute_data(frame, opcodes, retval);
+
+        // execute the code (the variables are written back into the symbol table when it returns)
+        zend_execute_ex(frame);
+
+        // remove the stack frame
+        zend_vm_stack_free_call_frame(frame);
+    }
+
     /**
      *  The opcodes
      *  @var zend_op_array
@@ -0,0 +1,262 @@
+/**
+ *  OutputWriter.cpp
+ *
+ *  Implementation file for the OutputWriter class
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  The writer that is also used by Php::out
+ *  @var    OutputWriter
+ */
+thread_local OutputWriter output;
+
+/**
+ *  Destructor, flushes the buffer
+ */
+OutputWriter::~OutputWriter()
+{
+    // write the remaining data
+    flush();
+
+    // forget the buffer
+    delete[] _buffer;
+}
+
+/**
+ *  Change the size of the buffer
+ *  @param  capacity    New size of the buffer
+ */
+void OutputWriter::capacity(size_t capacity)
+{
+    // write the data that is in the old buffer
+    flush();
+
+    // the new buffer is allocated on first use
+    delete[] _buffer;
+
+    // reset the buffer
+    _buffer = nullptr;
+    _capacity = std::max(capacity, (size_t)64);
+}
+
+/**
+ *  Make sure that a number of bytes can be added to the buffer
+ *  @param  size        Number of bytes that are needed (at most 64)
+ */
+void OutputWriter::reserve(size_t size)
+{
+    // allocate the buffer on first use
+    if (_buffer == nullptr) _buffer = new char[_capacity];
+
+    // write the buffered data if there is not enough room left
+    if (size > _capacity - _size) flush();
+}
+
+/**
+ *  Write data that did not fit in the buffer
+ *  @param  data        The data to write
+ *  @param  size        Size of the data
+ *  @return OutputWriter
+ */
+OutputWriter &OutputWriter::write(const char *data, size_t size)
+{
+    // the data that is already in the buffer goes first
+    flush();
+
+    // data that is at least as big as the buffer is not copied
+    if (size >= _capacity) return php_output_write(data, size), *this;
+
+    // allocate the buffer on first use
+    if (_buffer == nullptr) _buffer = new char[_capacity];
+
+    // copy the data into the (empty) buffer
+    memcpy(_buffer, data, size);
+
+    // update the size
+    _size = size;
+
+    // allow chaining
+    return *this;
+}
+
+/**
+ *  Append multiple pieces of data at once
+ *  @param  segments    The pieces to write
+ *  @return OutputWriter
+ */
+OutputWriter &OutputWriter::append(std::initializer_list<Segment> segments)
+{
+    // write all segments, the big ones go to the output layer directly
+    for (const auto &segment : segments) append(segment.data, segment.size);
+
+    // allow chaining
+    return *this;
+}
+
+/**
+ *  Format a signed number into the buffer
+ *  @param  value       The number to write
+ *  @return OutputWriter
+ */
+OutputWriter &OutputWriter::formatSigned(int64_t value)
+{
+    // positive numbers need no sign
+    if (value >= 0) return formatUnsigned(value);
+
+    // write the sign
+    append('-');
+
+    // write the absolute value (this also works for the smallest number)
+    return formatUnsigned(0 - (uint64_t)value);
+}
+
+/**
+ *  Format an unsigned number into the buffer
+ *  @param  value       The number to write
+ *  @return OutputWriter
+ */
+OutputWriter &OutputWriter::formatUnsigned(uint64_t value)
+{
+    // the digits are generated from right to left
+    char digits[20];
+    char *begin = digits + sizeof(digits);
+
+    // generate the digits
+    do *--begin = '0' + value % 10; while (value /= 10);
+
+    // size of the number
+    size_t size = digits + sizeof(digits) - begin;
+
+    // make sure there is room in the buffer
+    reserve(size);
+
+    // copy the digits
+    memcpy(_buffer + _size, begin, size);
+
+    // update the size
+    _size += size;
+
+    // allow chaining
+    return *this;
+}
+
+/**
+ *  Append a floating point number
+ *  @param  value       The number to write
+ *  @return OutputWriter
+ */
+OutputWriter &OutputWriter::append(double value)
+{
+    // the number of digits, -1 (the default) gives the shortest notation that
+    // still holds the exact same value
+    return formatFloat(value, (int)PG(serialize_precision));
+}
+
+/**
+ *  Append a PHP value
+ *  @param  value       The value to write
+ *  @return OutputWriter
+ */
+OutputWriter &OutputWriter::append(const Value &value)
+{
+    // strings are written directly
+    if (value.isString()) return append(value.rawValue(), value.size());
+
+    // numbers are formatted into the buffer (floats just like echo does)
+    if (value.isNumeric()) return append(value.numericValue());
+    if (value.isFloat()) return formatFloat(value.floatValue(), (int)EG(precision));
+
+    // other values have to be converted
+    return append(value.stringValue());
+}
+
+/**
+ *  Format a floating point number with a number of digits
+ *  @param  value       The number to write
+ *  @param  precision   Number of digits (-1 for the shortest exact notation)
+ *  @return OutputWriter
+ */
+OutputWriter &OutputWriter::formatFloat(double value, int precision)
+{
+    // infinity and nan are written like PHP does
+    if (std::isnan(value)) return append("NAN", 3);
+    if (std::isinf(value)) return value > 0 ? append("INF", 3) : append("-INF", 4);
+
+    // the precision has no upper limit, so the number is formatted in a buffer
+    // that is big enough for every double (just like PHP does)
+    char buffer[PHP_DOUBLE_MAX_LENGTH];
+
+    // format the number like PHP does, this does not depend on the locale
+#if PHP_VERSION_ID < 80100
+    php_gcvt(value, precision ? precision : 1, '.', 'E', buffer);
+#else
+    zend_gcvt(value, precision ? precision : 1, '.', 'E', buffer);
+#endif
+
+    // append the number
+    return append(buffer, strlen(buffer));
+}
+
+/**
+ *  Publish a buffer that stays valid during the call
+ *  @param  data        The data to write
+ *  @param  size        Size of the data
+ *  @return OutputWriter
+ */
+OutputWriter &OutputWriter::publish(const char *data, size_t size)
+{
+    // output handlers copy the data into their own buffers anyway
+    if (php_output_get_level() > 0) return append(data, size);
+
+    // the data that is already in the buffer goes first
+    flush();
+
+    // without handlers, the output layer passes the data straight to the sapi
+    php_output_write(data, size);
+
+    // allow chaining
+    return *this;
+}
+
+/**
+ *  Publish a PHP value
+ *  @param  value       The value to write
+ *  @return OutputWriter
+ */
+OutputWriter &OutputWriter::publish(const Value &value)
+{
+    // only strings have a buffer that can be published
+    return value.isString() ? publish(value.rawValue(), value.size()) : append(value);
+}
+
+/**
+ *  Pass the buffered data to the PHP output layer
+ *  @return OutputWriter
+ */
+OutputWriter &OutputWriter::flush()
+{
+    // is there anything to write?
+    if (_size == 0) return *this;
+
+    // write the data
+    php_output_write(_buffer, _size);
+
+    // the buffer is empty again
+    _size = 0;
+
+    // allow chaining
+    return *this;
+}
+
+/**
+ *  End namespace
+ */
+}
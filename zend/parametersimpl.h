@@ -20,10 +20,15 @@ class ParametersImpl : public Parameters
 public:
     /**
      *  Constructor
+     *
+     *  The object is retrieved on behalf of the function that is currently
+     *  executing, so that a shared object is copied first if that function
+     *  is going to modify it
+     *
      *  @param  this_ptr    Pointer to the object
      *  @param  argc        Number of arguments
      */
-    ParametersImpl(zval *this_ptr, uint32_t argc) : Parameters(this_ptr ? ObjectImpl::find(this_ptr)->object() : nullptr)
+    ParametersImpl(zval *this_ptr, uint32_t argc) : Parameters(this_ptr ? ObjectImpl::find(this_ptr)->object(EG(current_execute_data)->func) : nullptr)
     {
         // reserve plenty of space
         reserve(argc);
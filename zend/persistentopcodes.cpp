@@ -0,0 +1,377 @@
+/**
+ *  PersistentOpcodes.cpp
+ *
+ *  Implementation file for the persistent copy of a compiled script
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+
+/**
+ *  Scripts can only be copied when the opcodes refer to their literals and
+ *  jump targets with relative offsets, and when the script is not shared
+ *  between threads (the engine stores the runtime cache in the op array)
+ */
+#if PHP_VERSION_ID >= 80000 && !defined(ZTS) && !ZEND_USE_ABS_CONST_ADDR && !ZEND_USE_ABS_JMP_ADDR
+#define PHPCPP_PERSISTENT_OPCODES 1
+#endif
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Number of the current request
+ *  @var    uint64_t
+ */
+thread_local uint64_t PersistentOpcodes::_current = 0;
+
+/**
+ *  Create a persistent copy of a compiled script
+ *  @param  opcodes     The opcodes allocated on the request heap
+ *  @return PersistentOpcodes   or nullptr if the script can not be copied
+ */
+PersistentOpcodes *PersistentOpcodes::create(const zend_op_array *opcodes)
+{
+    // scripts with errors can not be copied
+    if (opcodes == nullptr) return nullptr;
+
+    // construct the object
+    std::unique_ptr<PersistentOpcodes> result(new PersistentOpcodes());
+
+    // copy the opcodes
+    if (!result->copy(opcodes)) return nullptr;
+
+    // expose the object
+    return result.release();
+}
+
+/**
+ *  Destructor
+ */
+PersistentOpcodes::~PersistentOpcodes()
+{
+    // free the op array
+    if (_opcodes)
+    {
+        // free the members (the literals are stored in the same block as the opcodes)
+        if (_opcodes->opcodes) pefree(_opcodes->opcodes, 1);
+        if (_opcodes->vars) pefree(_opcodes->vars, 1);
+        if (_opcodes->live_range) pefree(_opcodes->live_range, 1);
+        if (_opcodes->try_catch_array) pefree(_opcodes->try_catch_array, 1);
+
+        // free the op array itself
+        pefree(_opcodes, 1);
+    }
+
+    // free the arrays
+    for (auto *array : _arrays)
+    {
+        // the arrays were immutable, so the refcount was raised
+        GC_SET_REFCOUNT(array, 1);
+
+        // free the array
+        zend_hash_destroy(array);
+        pefree(array, 1);
+    }
+
+    // free the strings
+    for (auto &iter : _strings) pefree(iter.second, 1);
+}
+
+#ifdef PHPCPP_PERSISTENT_OPCODES
+
+/**
+ *  Copy the opcodes into persistent memory
+ *  @param  opcodes     The opcodes allocated on the request heap
+ *  @return bool
+ */
+bool PersistentOpcodes::copy(const zend_op_array *opcodes)
+{
+    // scripts with static variables or attributes are not supported
+    if (opcodes->static_variables || opcodes->attributes) return false;
+
+#if PHP_VERSION_ID >= 80100
+    // neither are scripts with closures or conditional functions
+    if (opcodes->num_dynamic_func_defs > 0) return false;
+#endif
+
+    // size of the opcodes, the literals are stored right behind them (this is done by pass_two())
+    size_t size = ZEND_MM_ALIGNED_SIZE_EX(sizeof(zend_op) * opcodes->last, 16);
+
+    // check that this is indeed the case
+    if (opcodes->last_literal > 0 && (char *)opcodes->literals != (char *)opcodes->opcodes + size) return false;
+
+    // scripts that declare functions or classes at runtime are not supported
+    for (uint32_t i = 0; i < opcodes->last; ++i)
+    {
+        // check the instruction
+        switch (opcodes->opcodes[i].opcode) {
+        case ZEND_DECLARE_FUNCTION:
+        case ZEND_DECLARE_LAMBDA_FUNCTION:
+        case ZEND_DECLARE_CLASS:
+        case ZEND_DECLARE_CLASS_DELAYED:
+        case ZEND_DECLARE_ANON_CLASS:
+            return false;
+        }
+    }
+
+    // copy the op array itself
+    _opcodes = (zend_op_array *)pemalloc(sizeof(zend_op_array), 1);
+    memcpy(_opcodes, opcodes, sizeof(zend_op_array));
+
+    // the members that are not yet copied should not point to the request heap
+    _opcodes->opcodes = nullptr;
+    _opcodes->literals = nullptr;
+    _opcodes->vars = nullptr;
+    _opcodes->live_range = nullptr;
+    _opcodes->try_catch_array = nullptr;
+    _opcodes->refcount = nullptr;
+
+    // the runtime cache is allocated on the request heap for every request
+    ZEND_MAP_PTR_INIT(_opcodes->run_time_cache, nullptr);
+    ZEND_MAP_PTR_INIT(_opcodes->static_variables_ptr, nullptr);
+    _opcodes->fn_flags |= ZEND_ACC_HEAP_RT_CACHE;
+
+    // copy the opcodes and the literals in one block, so that the relative offsets stay valid
+    _opcodes->opcodes = (zend_op *)pemalloc(size + sizeof(zval) * opcodes->last_literal, 1);
+    memcpy(_opcodes->opcodes, opcodes->opcodes, size + sizeof(zval) * opcodes->last_literal);
+    _opcodes->literals = (zval *)((char *)_opcodes->opcodes + size);
+
+    // the strings and arrays in the literals must be copied too
+    for (int i = 0; i < opcodes->last_literal; ++i) if (!persist(&_opcodes->literals[i])) return false;
+
+    // copy the names of the compiled variables
+    if (opcodes->last_var > 0)
+    {
+        // allocate the names
+        _opcodes->vars = (zend_string **)pemalloc(sizeof(zend_string *) * opcodes->last_var, 1);
+
+        // copy the names
+        for (int i = 0; i < opcodes->last_var; ++i) _opcodes->vars[i] = persist(opcodes->vars[i]);
+    }
+
+    // copy the live ranges of the temporary variables
+    if (opcodes->last_live_range > 0)
+    {
+        _opcodes->live_range = (zend_live_range *)pemalloc(sizeof(zend_live_range) * opcodes->last_live_range, 1);
+        memcpy(_opcodes->live_range, opcodes->live_range, sizeof(zend_live_range) * opcodes->last_live_range);
+    }
+
+    // copy the try/catch blocks
+    if (opcodes->last_try_catch > 0)
+    {
+        _opcodes->try_catch_array = (zend_try_catch_element *)pemalloc(sizeof(zend_try_catch_element) * opcodes->last_try_catch, 1);
+        memcpy(_opcodes->try_catch_array, opcodes->try_catch_array, sizeof(zend_try_catch_element) * opcodes->last_try_catch);
+    }
+
+    // copy the names
+    if (opcodes->filename) _opcodes->filename = persist(opcodes->filename);
+    if (opcodes->function_name) _opcodes->function_name = persist(opcodes->function_name);
+    if (opcodes->doc_comment) _opcodes->doc_comment = persist(opcodes->doc_comment);
+
+    // done
+    return true;
+}
+
+/**
+ *  Make a persistent copy of a string
+ *  @param  string
+ *  @return zend_string
+ */
+zend_string *PersistentOpcodes::persist(zend_string *string)
+{
+    // strings that were interned at startup live as long as the process
+    if (ZSTR_IS_INTERNED(string) && (GC_FLAGS(string) & IS_STR_PERMANENT)) return string;
+
+    // was the string already copied?
+    auto iter = _strings.find(string);
+    if (iter != _strings.end()) return iter->second;
+
+    // copy the string
+    zend_string *result = zend_string_init(ZSTR_VAL(string), ZSTR_LEN(string), 1);
+
+    // turn it into a permanent interned string, so that it is never refcounted
+    zend_string_hash_val(result);
+    GC_TYPE_INFO(result) = GC_STRING | ((IS_STR_INTERNED | IS_STR_PERSISTENT | IS_STR_PERMANENT) << GC_FLAGS_SHIFT);
+
+    // remember the copy
+    return _strings[string] = result;
+}
+
+/**
+ *  Make a persistent copy of an array
+ *  @param  array
+ *  @return zend_array  or nullptr if the array holds values that can not be copied
+ */
+zend_array *PersistentOpcodes::persist(zend_array *array)
+{
+    // the empty array is immutable already
+    if (zend_hash_num_elements(array) == 0) return (zend_array *)&zend_empty_array;
+
+    // create a persistent array
+    zend_array *result = (zend_array *)pemalloc(sizeof(zend_array), 1);
+    zend_hash_init(result, zend_hash_num_elements(array), nullptr, nullptr, 1);
+
+    // remember the array, so that it is freed
+    _arrays.push_back(result);
+
+    // the members of the array
+    zend_ulong index;
+    zend_string *key;
+    zval *value;
+
+    // copy all members
+    ZEND_HASH_FOREACH_KEY_VAL(array, index, key, value) {
+
+        // copy the value
+        zval copy;
+        ZVAL_COPY_VALUE(&copy, value);
+
+        // the value must be copied to persistent memory too
+        if (!persist(&copy)) return nullptr;
+
+        // add it to the array
+        if (key) zend_hash_add_new(result, persist(key), &copy);
+        else zend_hash_index_add_new(result, index, &copy);
+
+    } ZEND_HASH_FOREACH_END();
+
+    // the array is immutable, so the engine separates it before changing it
+    GC_SET_REFCOUNT(result, 2);
+    GC_ADD_FLAGS(result, IS_ARRAY_IMMUTABLE);
+
+    // done
+    return result;
+}
+
+/**
+ *  Make a persistent copy of a literal
+ *  @param  value
+ *  @return bool
+ */
+bool PersistentOpcodes::persist(zval *value)
+{
+    // check the type
+    switch (Z_TYPE_P(value)) {
+    case IS_UNDEF:
+    case IS_NULL:
+    case IS_FALSE:
+    case IS_TRUE:
+    case IS_LONG:
+    case IS_DOUBLE:
+        // scalars can be used as they are
+        return true;
+
+    case IS_STRING:
+        // use a permanent interned string
+        ZVAL_INTERNED_STR(value, persist(Z_STR_P(value)));
+        return true;
+
+    case IS_ARRAY:
+        {
+            // copy the array
+            zend_array *array = persist(Z_ARRVAL_P(value));
+
+            // arrays with values that can not be copied are not supported
+            if (array == nullptr) return false;
+
+            // immutable arrays are not refcounted
+            ZVAL_ARR(value, array);
+            Z_TYPE_FLAGS_P(value) = 0;
+            return true;
+        }
+
+    default:
+        // constant expressions and other values are not supported
+        return false;
+    }
+}
+
+/**
+ *  Execute the opcodes
+ *  @param  symbols     Optional variables of an isolated scope
+ *  @return Value
+ */
+Value PersistentOpcodes::execute(zend_array *symbols)
+{
+    // the runtime cache of an earlier request was allocated on the heap of
+    // that request, and so was the one of an execution that was aborted
+    if (_depth == 0 || _request != _current) ZEND_MAP_PTR_INIT(_opcodes->run_time_cache, nullptr);
+
+    // remember the execution
+    if (_request != _current) _depth = 0;
+    _request = _current;
+    _depth += 1;
+
+    try
+    {
+        // execute the opcodes
+        Value result = Opcodes::execute(_opcodes, symbols);
+
+        // the execution is over
+        leave();
+
+        // done
+        return result;
+    }
+    catch (...)
+    {
+        // the execution is over
+        leave();
+
+        // pass on the exception
+        throw;
+    }
+}
+
+/**
+ *  Called when an execution ends
+ */
+void PersistentOpcodes::leave()
+{
+    // the runtime cache is still in use by an outer execution
+    if (--_depth > 0) return;
+
+    // free the runtime cache that the engine allocated on the request heap
+    if (ZEND_MAP_PTR(_opcodes->run_time_cache)) efree(ZEND_MAP_PTR(_opcodes->run_time_cache));
+
+    // the next execution allocates a new one
+    ZEND_MAP_PTR_INIT(_opcodes->run_time_cache, nullptr);
+}
+
+#else
+
+/**
+ *  Copy the opcodes into persistent memory (not supported on this build)
+ *  @param  opcodes     The opcodes allocated on the request heap
+ *  @return bool
+ */
+bool PersistentOpcodes::copy(const zend_op_array *opcodes) { return false; }
+
+/**
+ *  Make a persistent copy of a string, an array or a zval (not supported on this build)
+ */
+zend_string *PersistentOpcodes::persist(zend_string *string) { return nullptr; }
+zend_array *PersistentOpcodes::persist(zend_array *array) { return nullptr; }
+bool PersistentOpcodes::persist(zval *value) { return false; }
+
+/**
+ *  Execute the opcodes (never called, because no objects are created)
+ *  @param  symbols     Optional variables of an isolated scope
+ *  @return Value
+ */
+Value PersistentOpcodes::execute(zend_array *symbols) { return nullptr; }
+
+/**
+ *  Called when an execution ends
+ */
+void PersistentOpcodes::leave() {}
+
+#endif
+
+/**
+ *  End namespace
+ */
+}
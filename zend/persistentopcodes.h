@@ -0,0 +1,125 @@
+/**
+ *  PersistentOpcodes.h
+ *
+ *  A copy of a compiled script in persistent memory, so that it can be
+ *  executed in all later requests without being compiled again. This is
+ *  similar to what opcache does with the scripts that it keeps in shared
+ *  memory: the opcodes, literals and variable names are copied out of the
+ *  request heap, strings are turned into permanent interned strings and
+ *  arrays into immutable arrays.
+ *
+ *  Only scripts that do not declare functions, closures or classes can be
+ *  copied, and only on non-thread-safe PHP 8 builds. For other scripts the
+ *  create() method returns a nullptr.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class PersistentOpcodes
+{
+private:
+    /**
+     *  The persistent copy of the opcodes
+     *  @var    zend_op_array
+     */
+    zend_op_array *_opcodes = nullptr;
+
+    /**
+     *  The strings that were copied, indexed by the original string
+     *  @var    std::unordered_map
+     */
+    std::unordered_map<zend_string*, zend_string*> _strings;
+
+    /**
+     *  The arrays that were copied
+     *  @var    std::vector
+     */
+    std::vector<zend_array*> _arrays;
+
+    /**
+     *  Number of executions that are running (the script may execute itself)
+     *  @var    int
+     */
+    int _depth = 0;
+
+    /**
+     *  The request in which the opcodes were last executed
+     *  @var    uint64_t
+     */
+    uint64_t _request = 0;
+
+    /**
+     *  Number of the current request
+     *  @var    uint64_t
+     */
+    static thread_local uint64_t _current;
+
+    /**
+     *  Constructor, use create() instead
+     */
+    PersistentOpcodes() = default;
+
+    /**
+     *  Copy the opcodes into persistent memory
+     *  @param  opcodes     The opcodes allocated on the request heap
+     *  @return bool
+     */
+    bool copy(const zend_op_array *opcodes);
+
+    /**
+     *  Make a persistent copy of a string, an array or a zval
+     *  @param  string
+     *  @return zend_string
+     */
+    zend_string *persist(zend_string *string);
+    zend_array *persist(zend_array *array);
+    bool persist(zval *value);
+
+    /**
+     *  Called when an execution ends
+     */
+    void leave();
+
+public:
+    /**
+     *  Create a persistent copy of a compiled script
+     *  @param  opcodes     The opcodes allocated on the request heap
+     *  @return PersistentOpcodes   or nullptr if the script can not be copied
+     */
+    static PersistentOpcodes *create(const zend_op_array *opcodes);
+
+    /**
+     *  Called when a new request starts
+     */
+    static void start() { _current += 1; }
+
+    /**
+     *  Deleted copy constructor
+     */
+    PersistentOpcodes(const PersistentOpcodes &that) = delete;
+
+    /**
+     *  Destructor
+     */
+    virtual ~PersistentOpcodes();
+
+    /**
+     *  Execute the opcodes
+     *  @param  symbols     Optional variables of an isolated scope
+     *  @return Value
+     */
+    Value execute(zend_array *symbols = nullptr);
+};
+
+/**
+ *  End namespace
+ */
+}
@@ -0,0 +1,101 @@
+/**
+ *  PersistentScript.cpp
+ *
+ *  Implementation file for the PersistentScript class
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Destructor
+ */
+PersistentScript::~PersistentScript()
+{
+    // free the persistent copy
+    delete _opcodes;
+}
+
+/**
+ *  Compile the script for the first time, and execute it
+ *  @param  symbols     Symbol table of an isolated scope, or nullptr
+ *  @return Value
+ */
+Value PersistentScript::compile(zend_array *symbols)
+{
+    // the script is compiled only once
+    _compiled = true;
+
+    // the number of functions and classes before compiling, top level declarations
+    // are added to these tables at compile time, and would be missing in later requests
+    auto functions = zend_hash_num_elements(CG(function_table));
+    auto classes = zend_hash_num_elements(CG(class_table));
+
+    // compile the script in the current request
+    auto opcodes = std::make_shared<Opcodes>(Script::compile(_name.c_str(), _source.data(), _source.size()));
+
+    // make a persistent copy if nothing was declared
+    if (functions == zend_hash_num_elements(CG(function_table)) && classes == zend_hash_num_elements(CG(class_table)))
+    {
+        // copy the opcodes
+        _opcodes = PersistentOpcodes::create(opcodes->opcodes());
+
+        // from now on we execute the copy
+        if (_opcodes) return _opcodes->execute(symbols);
+    }
+
+    // the script can not be kept, it is used from the cache for the rest of this request
+    ScriptCache::add(_name.c_str(), _source.data(), _source.size(), opcodes);
+
+    // execute the compiled script
+    return opcodes->execute(symbols);
+}
+
+/**
+ *  Execute the script
+ *  The return value of the script is returned
+ *  @return Value
+ */
+Value PersistentScript::execute()
+{
+    // execute in the scope of the caller
+    return execute(nullptr);
+}
+
+/**
+ *  Execute the script in an isolated scope
+ *  @param  scope       The scope with the variables
+ *  @return Value
+ */
+Value PersistentScript::execute(Scope &scope)
+{
+    // execute with the variables of the scope
+    return execute(scope.symbols());
+}
+
+/**
+ *  Execute the script
+ *  @param  symbols     Symbol table of an isolated scope, or nullptr
+ *  @return Value
+ */
+Value PersistentScript::execute(zend_array *symbols)
+{
+    // execute the persistent copy
+    if (_opcodes) return _opcodes->execute(symbols);
+
+    // compile the script the first time
+    if (!_compiled) return compile(symbols);
+
+    // the script could not be copied, so it is compiled once in every request
+    return ScriptCache::get(_name.c_str(), _source.data(), _source.size(), &Script::compile)->execute(symbols);
+}
+
+/**
+ *  End namespace
+ */
+}
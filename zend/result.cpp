@@ -0,0 +1,131 @@
+/**
+ *  Result.cpp
+ *
+ *  Implementation file for the ResultBase class
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Helper function to read a property of the pending exception
+ *  @param  name
+ *  @param  size
+ *  @param  tmp         storage for the property, if it has to be created
+ *  @return zval
+ */
+static zval *property(const char *name, size_t size, zval *tmp)
+{
+    // the pending exception
+    auto *object = EG(exception);
+
+#if PHP_VERSION_ID < 80000
+    // the object as zval
+    zval exception;
+    ZVAL_OBJ(&exception, object);
+
+    // read the property
+    return zend_read_property(object->ce, &exception, name, size, 1, tmp);
+#else
+    // read the property
+    return zend_read_property(object->ce, object, name, size, 1, tmp);
+#endif
+}
+
+/**
+ *  Constructor for an exception or error that is thrown when the result
+ *  is returned to PHP
+ *  @param  throwable   The exception or error
+ */
+ResultBase::ResultBase(const Throwable &throwable) : _status(Status::Pending)
+{
+    // is this a wrapped PHP exception that is still pending in the engine?
+    if (dynamic_cast<const Rethrowable *>(&throwable) && EG(exception))
+    {
+        // the exception should stay in the engine, so that the original object
+        // (with its class, trace and previous exceptions) ends up in PHP space
+        const_cast<Throwable &>(throwable).rethrow();
+    }
+    else
+    {
+        // a new exception or error is thrown when the result is returned to PHP
+        _status = dynamic_cast<const Error *>(&throwable) ? Status::Error : Status::Exception;
+        _code = throwable.code();
+        _message = throwable.what();
+    }
+}
+
+/**
+ *  The error message
+ *  @return std::string
+ */
+std::string ResultBase::message() const
+{
+    // only pending exceptions have to be read from the engine
+    if (_status != Status::Pending || EG(exception) == nullptr) return _message;
+
+    // the message property
+    zval tmp;
+    auto *message = zval_get_string(property(ZEND_STRL("message"), &tmp));
+
+    // copy message to a string
+    std::string result(ZSTR_VAL(message), ZSTR_LEN(message));
+
+    // clean up message string
+    zend_string_release(message);
+
+    // done
+    return result;
+}
+
+/**
+ *  The error code
+ *  @return long int
+ */
+long int ResultBase::code() const
+{
+    // only pending exceptions have to be read from the engine
+    if (_status != Status::Pending || EG(exception) == nullptr) return _code;
+
+    // read the code property
+    zval tmp;
+    return zval_get_long(property(ZEND_STRL("code"), &tmp));
+}
+
+/**
+ *  Remove the pending PHP exception from the engine
+ */
+void ResultBase::discard()
+{
+    // leap out if there is no pending exception
+    if (_status != Status::Pending) return;
+
+    // the exception could also have been removed by someone else
+    if (EG(exception))
+    {
+        // remember the message and the code
+        _message = message();
+        _code = code();
+
+        // remember whether this was an error or an exception
+        _status = instanceof_function(EG(exception)->ce, zend_ce_error) ? Status::Error : Status::Exception;
+
+        // remove the exception
+        zend_clear_exception();
+    }
+    else
+    {
+        // there is nothing left to report
+        _status = Status::Exception;
+    }
+}
+
+/**
+ *  End namespace
+ */
+}
@@ -0,0 +1,46 @@
+/**
+ *  Scope.cpp
+ *
+ *  Implementation file for the Scope class
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Add variables to the scope, existing variables with the same name
+ *  are overwritten
+ *  @param  variables   Array of variables, indexed by name
+ *  @return Scope
+ */
+Scope &Scope::assign(const Array &variables)
+{
+    // merge all variables in one go
+    zend_hash_merge(symbols(), Z_ARRVAL_P(variables._val), zval_add_ref, 1);
+
+    // allow chaining
+    return *this;
+}
+
+/**
+ *  The symbol table that is used when a script is executed
+ *  @return zend_array
+ */
+zend_array *Scope::symbols()
+{
+    // the engine writes into the table, so it may not be shared with other values
+    SEPARATE_ARRAY(_variables._val);
+
+    // expose the table
+    return Z_ARRVAL_P(_variables._val);
+}
+
+/**
+ *  End namespace
+ */
+}
@@ -54,18 +54,14 @@ zend_op_array *Script::compile(const char *name, const char *phpcode, size_t siz
  */
 Script::Script(const char *name, const char *phpcode, size_t size) _NOEXCEPT
 {
-    // construct opcodes
-    _opcodes = new Opcodes(compile(name, phpcode, size));
+    // get the opcodes from the cache, or compile the script
+    _opcodes = ScriptCache::get(name, phpcode, size, &Script::compile);
 }
 
 /**
  *  Destructor
  */
-Script::~Script()
-{
-    // remove opcodes
-    delete _opcodes;
-}
+Script::~Script() {}
 
 /**
  *  Is the script a valid PHP script without syntax errors?
@@ -91,6 +87,30 @@ Value Script::execute() const
     return _opcodes->execute();
 }
 
+/**
+ *  Execute the script in an isolated scope
+ *  @param  scope       The scope with the variables
+ *  @return Value
+ */
+Value Script::execute(Scope &scope) const
+{
+    // pass on to opcodes
+    if (!_opcodes) return nullptr;
+
+    // execute opcodes with the variables of the scope
+    return _opcodes->execute(scope.symbols());
+}
+
+/**
+ *  Statistics of the cache of compiled scripts of the current thread
+ *  @return Value
+ */
+Value Script::statistics()
+{
+    // pass on to the cache
+    return ScriptCache::report();
+}
+
 /**
  *  End of namespace
  */
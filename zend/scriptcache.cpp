@@ -0,0 +1,241 @@
+/**
+ *  ScriptCache.cpp
+ *
+ *  Implementation file for the cache of compiled scripts
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  A single cached script
+ */
+struct CachedScript
+{
+    /**
+     *  Hash of the source code
+     *  @var    zend_ulong
+     */
+    zend_ulong hash;
+
+    /**
+     *  Name and source code of the script, to rule out hash collisions
+     *  @var    std::string
+     */
+    std::string name;
+    std::string source;
+
+    /**
+     *  The compiled script
+     *  @var    std::shared_ptr<Opcodes>
+     */
+    std::shared_ptr<Opcodes> opcodes;
+};
+
+/**
+ *  The cache of a single thread
+ */
+class ThreadScripts
+{
+public:
+    /**
+     *  The scripts, the most recently used script comes first
+     *  @var    std::list
+     */
+    std::list<CachedScript> scripts;
+
+    /**
+     *  The scripts indexed by the hash of the source code
+     *  @var    std::unordered_map
+     */
+    std::unordered_map<zend_ulong, std::list<CachedScript>::iterator> index;
+
+    /**
+     *  Total size of the cached source code
+     *  @var    size_t
+     */
+    size_t bytes = 0;
+
+    /**
+     *  The limits, no scripts are cached outside a request
+     *  @var    size_t
+     */
+    size_t maxentries = 0;
+    size_t maxbytes = 0;
+
+    /**
+     *  Number of hits, misses and evictions
+     *  @var    uint64_t
+     */
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    /**
+     *  Remove the least recently used script
+     */
+    void evict()
+    {
+        // the script to remove
+        auto &script = scripts.back();
+
+        // forget the script
+        index.erase(script.hash);
+        bytes -= script.source.size();
+
+        // remove the script (the opcodes stay alive if a Php::Script still uses them)
+        scripts.pop_back();
+
+        // update the counter
+        evictions += 1;
+    }
+};
+
+/**
+ *  The cache of the current thread
+ *  @var    ThreadScripts
+ */
+static thread_local ThreadScripts cache;
+
+/**
+ *  Retrieve the opcodes of a script, the script is compiled if it is
+ *  not yet in the cache
+ *  @param  name        Name of the script
+ *  @param  source      PHP source code
+ *  @param  size        Length of the source code
+ *  @param  compiler    Function that compiles the source code
+ *  @return std::shared_ptr<Opcodes>
+ */
+std::shared_ptr<Opcodes> ScriptCache::get(const char *name, const char *source, size_t size, Compiler compiler)
+{
+    // if the cache is disabled, or the script is too big to cache, we just compile it
+    if (cache.maxentries == 0 || size > cache.maxbytes) return std::make_shared<Opcodes>(compiler(name, source, size));
+
+    // hash the source code
+    zend_ulong hash = zend_inline_hash_func(source, size);
+
+    // look up the script
+    auto iter = cache.index.find(hash);
+
+    // is it in the cache?
+    if (iter != cache.index.end())
+    {
+        // the cached script
+        auto &script = *iter->second;
+
+        // check that it really is the same script
+        if (script.name == name && script.source.size() == size && memcmp(script.source.data(), source, size) == 0)
+        {
+            // it is now the most recently used script
+            cache.scripts.splice(cache.scripts.begin(), cache.scripts, iter->second);
+
+            // update the counter
+            cache.hits += 1;
+
+            // no need to compile
+            return script.opcodes;
+        }
+    }
+
+    // update the counter
+    cache.misses += 1;
+
+    // compile the script
+    auto opcodes = std::make_shared<Opcodes>(compiler(name, source, size));
+
+    // store it in the cache
+    add(name, source, size, opcodes);
+
+    // done
+    return opcodes;
+}
+
+/**
+ *  Add a script that was compiled elsewhere to the cache
+ *  @param  name        Name of the script
+ *  @param  source      PHP source code
+ *  @param  size        Length of the source code
+ *  @param  opcodes     The compiled script
+ */
+void ScriptCache::add(const char *name, const char *source, size_t size, const std::shared_ptr<Opcodes> &opcodes)
+{
+    // scripts with errors are not cached, so that the error is reported every time
+    if (!opcodes->valid() || cache.maxentries == 0 || size > cache.maxbytes) return;
+
+    // hash the source code
+    zend_ulong hash = zend_inline_hash_func(source, size);
+
+    // a script with the same hash is replaced
+    auto iter = cache.index.find(hash);
+    if (iter != cache.index.end())
+    {
+        // remove the old script
+        cache.bytes -= iter->second->source.size();
+        cache.scripts.erase(iter->second);
+        cache.index.erase(iter);
+    }
+
+    // make room for the script
+    while (!cache.scripts.empty() && (cache.scripts.size() >= cache.maxentries || cache.bytes + size > cache.maxbytes)) cache.evict();
+
+    // add the script to the front of the list
+    cache.scripts.push_front(CachedScript{ hash, name, std::string(source, size), opcodes });
+    cache.index[hash] = cache.scripts.begin();
+    cache.bytes += size;
+}
+
+/**
+ *  Start using the cache for a new request
+ *  @param  entries     Max number of cached scripts (0 to disable the cache)
+ *  @param  bytes       Max total size of the cached source code
+ */
+void ScriptCache::start(size_t entries, size_t bytes)
+{
+    // set the limits
+    cache.maxentries = entries;
+    cache.maxbytes = bytes;
+}
+
+/**
+ *  Empty the cache at the end of the request
+ */
+void ScriptCache::stop()
+{
+    // scripts that are evaluated after this (by other extensions) are not cached
+    cache.maxentries = 0;
+
+    // the opcodes live on the request heap, so they must be destroyed now
+    cache.index.clear();
+    cache.scripts.clear();
+    cache.bytes = 0;
+}
+
+/**
+ *  The number of hits, misses and evictions of this thread
+ *  @return Value
+ */
+Value ScriptCache::report()
+{
+    // the result
+    Array result;
+
+    // add the counters
+    result["hits"] = (int64_t)cache.hits;
+    result["misses"] = (int64_t)cache.misses;
+    result["evictions"] = (int64_t)cache.evictions;
+    result["entries"] = (int64_t)cache.scripts.size();
+    result["bytes"] = (int64_t)cache.bytes;
+
+    // done
+    return result;
+}
+
+/**
+ *  End namespace
+ */
+}
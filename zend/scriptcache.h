@@ -0,0 +1,73 @@
+/**
+ *  ScriptCache.h
+ *
+ *  Cache of compiled scripts for Php::eval() and Php::Script. Code that is
+ *  evaluated over and over again is only compiled the first time, later
+ *  evaluations re-use the opcodes. The cache is bounded by the number of
+ *  entries ("phpcpp.eval_cache" php.ini setting) and the total size of the
+ *  cached source code ("phpcpp.eval_cache_size"), the least recently used
+ *  script is evicted first. The opcodes are allocated on the request heap,
+ *  so the cache is emptied at the end of each request.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class ScriptCache
+{
+public:
+    /**
+     *  Function that compiles the source code
+     */
+    using Compiler = struct _zend_op_array *(*)(const char *name, const char *source, size_t size);
+
+    /**
+     *  Retrieve the opcodes of a script, the script is compiled if it is
+     *  not yet in the cache
+     *  @param  name        Name of the script
+     *  @param  source      PHP source code
+     *  @param  size        Length of the source code
+     *  @param  compiler    Function that compiles the source code
+     *  @return std::shared_ptr<Opcodes>
+     */
+    static std::shared_ptr<Opcodes> get(const char *name, const char *source, size_t size, Compiler compiler);
+
+    /**
+     *  Add a script that was compiled elsewhere to the cache
+     *  @param  name        Name of the script
+     *  @param  source      PHP source code
+     *  @param  size        Length of the source code
+     *  @param  opcodes     The compiled script
+     */
+    static void add(const char *name, const char *source, size_t size, const std::shared_ptr<Opcodes> &opcodes);
+
+    /**
+     *  Start using the cache for a new request
+     *  @param  entries     Max number of cached scripts (0 to disable the cache)
+     *  @param  bytes       Max total size of the cached source code
+     */
+    static void start(size_t entries, size_t bytes);
+
+    /**
+     *  Empty the cache at the end of the request
+     */
+    static void stop();
+
+    /**
+     *  The number of hits, misses and evictions of this thread
+     *  @return Value
+     */
+    static Value report();
+};
+
+/**
+ *  End namespace
+ */
+}
@@ -0,0 +1,320 @@
+/**
+ *  Statistics.cpp
+ *
+ *  Implementation file for the handler statistics
+ *
+ *  @copyright 2026 Copernica BV
+ */
+#include "includes.h"
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Are the counters enabled for the current request?
+ *  @var    bool
+ */
+thread_local bool Statistics::enabled = false;
+
+/**
+ *  Counter for a single handler of a single class. Only the thread that owns
+ *  the counter writes to it, so a relaxed load and store is enough (there is
+ *  no need for an expensive atomic increment)
+ */
+struct HandlerCounter
+{
+    /**
+     *  Number of calls and number of elapsed ticks
+     *  @var    std::atomic<uint64_t>
+     */
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> ticks;
+
+    /**
+     *  Constructor
+     */
+    HandlerCounter() : calls(0), ticks(0) {}
+
+    /**
+     *  Add a measurement
+     *  @param  elapsed
+     */
+    void add(uint64_t elapsed)
+    {
+        // update the counters
+        calls.store(calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        ticks.store(ticks.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+    }
+};
+
+/**
+ *  All counters of one thread, for each class a row of counters
+ */
+using Counters = std::vector<std::array<HandlerCounter, Statistics::Handlers>>;
+
+/**
+ *  Totals, used when merging counters
+ */
+using Totals = std::vector<std::array<std::pair<uint64_t,uint64_t>, Statistics::Handlers>>;
+
+/**
+ *  Names of the registered classes, the index is the identifier
+ *  @var    std::vector
+ */
+static std::vector<std::string> classes;
+
+/**
+ *  Mutex to protect the list of counters, and the totals of threads that
+ *  have ended
+ *  @var    std::mutex
+ */
+static std::mutex mutex;
+
+/**
+ *  Counters of all running threads
+ *  @var    std::list
+ */
+static std::list<Counters*> threads;
+
+/**
+ *  Totals of the threads that have ended
+ *  @var    Totals
+ */
+static Totals retired;
+
+/**
+ *  Names of the handlers
+ *  @var    const char *
+ */
+static const char *names[Statistics::Handlers] = {
+    "createObject", "cloneObject", "destructObject", "freeObject",
+    "getMethod", "callMethod", "callInvoke",
+    "readProperty", "writeProperty", "hasProperty", "unsetProperty",
+    "readDimension", "writeDimension", "hasDimension", "unsetDimension",
+    "countElements", "cast"
+};
+
+/**
+ *  Helper function to add counters to the totals
+ *  @param  counters
+ *  @param  totals
+ */
+static void merge(const Counters &counters, Totals &totals)
+{
+    // make sure there is room for all classes
+    if (totals.size() < counters.size()) totals.resize(counters.size());
+
+    // add all counters
+    for (size_t c = 0; c < counters.size(); ++c)
+    {
+        for (size_t h = 0; h < Statistics::Handlers; ++h)
+        {
+            // add the calls and the ticks
+            totals[c][h].first += counters[c][h].calls.load(std::memory_order_relaxed);
+            totals[c][h].second += counters[c][h].ticks.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ *  Helper class with the counters of a thread, that registers itself in
+ *  the list of running threads
+ */
+class ThreadCounters
+{
+public:
+    /**
+     *  The counters
+     *  @var    Counters
+     */
+    Counters counters;
+
+    /**
+     *  Constructor
+     */
+    ThreadCounters() : counters(classes.size())
+    {
+        // lock the list
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // register the counters
+        threads.push_back(&counters);
+    }
+
+    /**
+     *  Destructor
+     */
+    ~ThreadCounters()
+    {
+        // lock the list
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // keep the totals of this thread
+        merge(counters, retired);
+
+        // unregister the counters
+        threads.remove(&counters);
+    }
+};
+
+/**
+ *  Register a class, this returns the identifier of its counters
+ *  @param  name        Name of the class
+ *  @return size_t
+ */
+size_t Statistics::add(const std::string &name)
+{
+    // classes are registered at startup, when there are no running requests,
+    // a class that is registered again (because the extension is reloaded)
+    // keeps its identifier, so that the counters of the threads still fit
+    auto iter = std::find(classes.begin(), classes.end(), name);
+    if (iter != classes.end()) return iter - classes.begin();
+
+    // this is a new class
+    classes.push_back(name);
+
+    // the identifier is the index
+    return classes.size() - 1;
+}
+
+/**
+ *  Store a measurement
+ *  @param  entry       Class entry of the object
+ *  @param  handler     The handler that was called
+ *  @param  ticks       Number of elapsed ticks
+ */
+void Statistics::record(zend_class_entry *entry, Handler handler, uint64_t ticks)
+{
+    // the counters of this thread
+    static thread_local ThreadCounters thread;
+
+    // find the class
+    auto id = ClassImpl::statistics(entry);
+
+    // classes that were registered after the thread started are not counted
+    if (id >= thread.counters.size()) return;
+
+    // update the counter
+    thread.counters[id][handler].add(ticks);
+}
+
+/**
+ *  Helper function to retrieve the totals of all threads
+ *  @return Totals
+ */
+static Totals totals()
+{
+    // lock the list
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // start with the threads that have ended
+    Totals result(retired);
+
+    // add the running threads
+    for (auto *counters : threads) merge(*counters, result);
+
+    // done
+    return result;
+}
+
+/**
+ *  Retrieve all counters, merged over all threads
+ *  @return Value
+ */
+Value Statistics::report()
+{
+    // the result
+    Array result;
+
+    // get the totals
+    auto all = totals();
+
+    // add all classes
+    for (size_t c = 0; c < all.size(); ++c)
+    {
+        // the handlers of this class
+        Array handlers;
+
+        // add the handlers that were called
+        for (size_t h = 0; h < Handlers; ++h)
+        {
+            // skip handlers that were not called
+            if (all[c][h].first == 0) continue;
+
+            // the counters of this handler
+            Array counters;
+            counters["calls"] = (int64_t)all[c][h].first;
+            counters["ticks"] = (int64_t)all[c][h].second;
+
+            // add the counters
+            handlers[names[h]] = counters;
+        }
+
+        // add the class if any of its handlers were called
+        if (handlers.size() > 0) result[classes[c]] = handlers;
+    }
+
+    // done
+    return result;
+}
+
+/**
+ *  Write a summary of all counters to the error log
+ */
+void Statistics::log()
+{
+    // get the totals
+    auto all = totals();
+
+    // write a line for each handler that was called
+    for (size_t c = 0; c < all.size(); ++c)
+    {
+        for (size_t h = 0; h < Handlers; ++h)
+        {
+            // skip handlers that were not called
+            if (all[c][h].first == 0) continue;
+
+            // the line to write
+            std::string line = "phpcpp.stats " + classes[c] + "::" + names[h] + " calls=" + std::to_string(all[c][h].first) + " ticks=" + std::to_string(all[c][h].second);
+
+            // write to the log
+            php_log_err((char *)line.c_str());
+        }
+    }
+}
+
+/**
+ *  Claim the right to register the phpcpp_stats() function
+ *  @return bool
+ */
+bool Statistics::claim()
+{
+    // was it already claimed?
+    static bool claimed = false;
+
+    // only the first one gets it
+    if (claimed) return false;
+
+    // it is claimed now
+    return claimed = true;
+}
+
+/**
+ *  The phpcpp_stats() function
+ *  @return NativeFunction
+ */
+NativeFunction &Statistics::function()
+{
+    // the function must stay in scope for the lifetime of the module
+    static NativeFunction function("phpcpp_stats", &Statistics::report);
+
+    // expose the function
+    return function;
+}
+
+/**
+ *  End namespace
+ */
+}
@@ -0,0 +1,173 @@
+/**
+ *  Statistics.h
+ *
+ *  Optional counters for the object handlers of native classes. For every
+ *  class and every handler the number of calls and the number of elapsed
+ *  ticks (TSC cycles on x86) are counted. The counters are disabled by
+ *  default, and can be enabled with the "phpcpp.stats" php.ini setting:
+ *  with value 1 the handlers are counted, with value 2 a summary is also
+ *  written to the error log at the end of each request. The counters can
+ *  be retrieved in PHP space with the phpcpp_stats() function.
+ *
+ *  Each thread has its own set of counters, so that counting does not need
+ *  locks. The sets are merged when the counters are read.
+ *
+ *  @copyright 2026 Copernica BV
+ */
+
+/**
+ *  Set up namespace
+ */
+namespace Php {
+
+/**
+ *  Class definition
+ */
+class Statistics
+{
+public:
+    /**
+     *  The handlers that are counted
+     */
+    enum Handler
+    {
+        CreateObject,
+        CloneObject,
+        DestructObject,
+        FreeObject,
+        GetMethod,
+        CallMethod,
+        CallInvoke,
+        ReadProperty,
+        WriteProperty,
+        HasProperty,
+        UnsetProperty,
+        ReadDimension,
+        WriteDimension,
+        HasDimension,
+        UnsetDimension,
+        CountElements,
+        Cast,
+
+        // number of handlers
+        Handlers
+    };
+
+    /**
+     *  Are the counters enabled for the current request?
+     *  @var    bool
+     */
+    static thread_local bool enabled;
+
+    /**
+     *  Helper class that measures a single handler call
+     */
+    class Scope
+    {
+    private:
+        /**
+         *  The class of the object on which the handler is called
+         *  @var    zend_class_entry
+         */
+        zend_class_entry *_entry;
+
+        /**
+         *  The handler that is measured
+         *  @var    Handler
+         */
+        Handler _handler;
+
+        /**
+         *  Tick count when the handler started, or zero if we do not count
+         *  @var    uint64_t
+         */
+        uint64_t _start;
+
+    public:
+        /**
+         *  Constructor
+         *  @param  entry       Class entry of the object
+         *  @param  handler     The handler that is measured
+         */
+        Scope(zend_class_entry *entry, Handler handler) :
+            _entry(entry), _handler(handler), _start(enabled ? now() : 0) {}
+
+        /**
+         *  Constructors for the handlers that only have the object
+         *  @param  object      The object on which the handler is called
+         *  @param  handler     The handler that is measured
+         */
+        Scope(const zend_object *object, Handler handler) : Scope(object->ce, handler) {}
+        Scope(const zval *object, Handler handler) : Scope(Z_OBJCE_P(object), handler) {}
+
+        /**
+         *  Destructor
+         */
+        ~Scope()
+        {
+            // store the measurement if we are counting
+            if (_start) record(_entry, _handler, now() - _start);
+        }
+    };
+
+    /**
+     *  Register a class, this returns the identifier of its counters
+     *  @param  name        Name of the class
+     *  @return size_t
+     */
+    static size_t add(const std::string &name);
+
+    /**
+     *  Store a measurement
+     *  @param  entry       Class entry of the object
+     *  @param  handler     The handler that was called
+     *  @param  ticks       Number of elapsed ticks
+     */
+    static void record(zend_class_entry *entry, Handler handler, uint64_t ticks);
+
+    /**
+     *  Retrieve all counters, merged over all threads, as an array indexed
+     *  by class name and handler name (this is the phpcpp_stats() function)
+     *  @return Value
+     */
+    static Value report();
+
+    /**
+     *  Write a summary of all counters to the error log
+     */
+    static void log();
+
+    /**
+     *  Claim the right to register the phpcpp_stats() function and the
+     *  php.ini setting. Only the first extension that asks gets it, because
+     *  all extensions share the same counters.
+     *  @return bool
+     */
+    static bool claim();
+
+    /**
+     *  The phpcpp_stats() function
+     *  @return NativeFunction
+     */
+    static NativeFunction &function();
+
+    /**
+     *  The current tick count
+     *  @return uint64_t
+     */
+    static uint64_t now()
+    {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        // read the time stamp counter
+        return __rdtsc();
+#else
+        // fall back to the monotonic clock
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
+};
+
+/**
+ *  End namespace
+ */
+}
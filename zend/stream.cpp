@@ -34,7 +34,11 @@ Stream::Stream(const Value &value) : _value(value)
 /**
  *  Destructor
  */
-Stream::~Stream() {}
+Stream::~Stream()
+{
+    // remove the mapping
+    unmap();
+}
 
 /**
  *  Size of the read-buffer (number of bytes that have already been read
@@ -66,6 +70,134 @@ int Stream::fd() const
     // on failure we return -1
     return result == SUCCESS ? retval : -1;
 }
+
+/**
+ *  Read data from the stream into a buffer
+ *  @param  buffer      buffer to read into
+ *  @param  size        size of the buffer
+ *  @return size_t      number of bytes read
+ */
+size_t Stream::read(char *buffer, size_t size)
+{
+    // read the data (before 7.4 this returned a size_t, now -1 is returned on failure)
+    auto result = php_stream_read(_stream, buffer, size);
+
+    // errors are reported as nothing read
+    return result > 0 ? result : 0;
+}
+
+/**
+ *  Write data to the stream
+ *  @param  buffer      data to write
+ *  @param  size        size of the data
+ *  @return size_t      number of bytes written
+ */
+size_t Stream::write(const char *buffer, size_t size)
+{
+    // write the data
+    auto result = php_stream_write(_stream, buffer, size);
+
+    // errors are reported as nothing written
+    return result > 0 ? result : 0;
+}
+
+/**
+ *  Access to the read-buffer, without copying the data
+ *  @return const char *
+ */
+const char *Stream::peek() const
+{
+    // the buffered data starts at the read position
+    return _stream->readbuf ? (const char *)_stream->readbuf + _stream->readpos : nullptr;
+}
+
+/**
+ *  Remove data from the read-buffer
+ *  @param  size        number of bytes to remove
+ */
+void Stream::consume(size_t size)
+{
+    // we can not remove more than there is in the buffer
+    size = std::min(size, readbuffer());
+
+    // skip the data, just like reading it would do
+    _stream->readpos += size;
+    _stream->position += size;
+}
+
+/**
+ *  Is the end of the stream reached?
+ *  @return bool
+ */
+bool Stream::eof() const
+{
+    // ask the stream
+    return php_stream_eof(_stream);
+}
+
+/**
+ *  Switch between blocking and non-blocking mode
+ *  @param  blocking    should the stream block?
+ *  @return bool
+ */
+bool Stream::blocking(bool blocking)
+{
+    // set the option (this returns the old mode, or a negative value when
+    // it failed or when the stream does not support it)
+    return php_stream_set_option(_stream, PHP_STREAM_OPTION_BLOCKING, blocking ? 1 : 0, nullptr) >= 0;
+}
+
+/**
+ *  Map (part of) the stream into memory
+ *  @param  offset      start of the mapping
+ *  @param  length      number of bytes to map (0 for the rest of the file)
+ *  @param  size        is filled with the number of bytes that were mapped
+ *  @return const char *
+ */
+const char *Stream::map(size_t offset, size_t length, size_t *size)
+{
+    // a stream has only one mapping at the time
+    unmap();
+
+    // nothing is mapped yet
+    if (size) *size = 0;
+
+    // check if the stream supports mapping at all
+    if (!php_stream_mmap_supported(_stream)) return nullptr;
+
+    // the number of bytes that are mapped
+    size_t mapped = 0;
+
+    // map the data
+    auto *result = php_stream_mmap_range(_stream, offset, length == 0 ? PHP_STREAM_MMAP_ALL : length, PHP_STREAM_MAP_MODE_SHARED_READONLY, &mapped);
+
+    // was this a success?
+    if (result == nullptr) return nullptr;
+
+    // remember that the stream must be unmapped
+    _mapped = true;
+
+    // expose the size
+    if (size) *size = mapped;
+
+    // done
+    return result;
+}
+
+/**
+ *  Remove the mapping
+ */
+void Stream::unmap()
+{
+    // is there a mapping?
+    if (!_mapped) return;
+
+    // remove the mapping
+    php_stream_mmap_unmap(_stream);
+
+    // forget the mapping
+    _mapped = false;
+}
     
 /**
  *  End of namespace
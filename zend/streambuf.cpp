@@ -31,13 +31,17 @@ int StreamBuf::sync()
         // which means that we have to include a printf() like format as first
         // parameter. We can not specify pbase() directly, because (1) it is
         // not null terminated and (2) it could contain % signs and allow all
-        // sorts of buffer overflows.
-        zend_error(_error, "%.*s", (int)size, pbase());
+        // sorts of buffer overflows. Messages that are repeated too often
+        // are not reported at all.
+        if (ErrorLimiter::allow(_error)) zend_error(_error, "%.*s", (int)size, pbase());
     }
     else
     {
+        // the data that was moved to the writer earlier goes first
+        output.flush();
+
         // write to zend
-        zend_write(pbase(), size);
+        php_output_write(pbase(), size);
     }
     
     // reset the buffer
@@ -47,6 +51,28 @@ int StreamBuf::sync()
     return 0;
 }
 
+/**
+ *  Move the buffered data out of the way, without flushing it
+ *  @return int
+ */
+int StreamBuf::drain()
+{
+    // errors can not be buffered anywhere else
+    if (_error) return sync();
+
+    // current buffer size
+    size_t size = pptr() - pbase();
+
+    // move the data to the writer, which has a much bigger buffer
+    output.append(pbase(), size);
+
+    // reset the buffer
+    pbump(-size);
+
+    // done
+    return 0;
+}
+
 /**
  *  End namespace
  */
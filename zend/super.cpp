@@ -5,7 +5,6 @@
  *  @author Emiel Bruijntjes <emiel.bruijntjes@copernica.com>
  */
 #include "includes.h"
-#include "string.h"
 
 /**
  *  Set up namespace
@@ -23,20 +22,36 @@ Super ENV       (TRACK_VARS_ENV,     "_ENV");
 Super FILES     (TRACK_VARS_FILES,   "_FILES");
 Super REQUEST   (TRACK_VARS_REQUEST, "_REQUEST");
 
+/**
+ *  Constructor
+ *  @param  index   index number
+ *  @param  name    name of the variable in PHP
+ */
+Super::Super(int index, const char *name) : _index(index), _key(zend_string_init(name, ::strlen(name), 1))
+{
+    // calculate the hash right away, so that lookups do not have to do that
+    zend_string_hash_val(_key);
+}
+
+/**
+ *  Destructor
+ */
+Super::~Super()
+{
+    // forget the name
+    zend_string_release(_key);
+}
+
 /**
  *  Convert object to a value
  *  @return Value
  */
 Value Super::value()
 {
-    // call zend_is_auto_global to ensure that the just-in-time globals are loaded
-    if (_name) {
-        // make the variable an auto global
-        zend_is_auto_global(String{ _name });
-
-        // reset because we only need to do this once
-        _name = nullptr;
-    }
+    // call zend_is_auto_global to ensure that the just-in-time globals are
+    // loaded, this has to be done in every request because they are created
+    // on first use again in every request
+    zend_is_auto_global(_key);
 
     // create a value object that wraps around the actual zval
     return &PG(http_globals)[_index];
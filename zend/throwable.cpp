@@ -18,52 +18,146 @@
 namespace Php {
 
 /**
- *  Helper function converts an object to a string
- *  @return std::string
+ *  Helper function to read a property of an object
+ *  @param  object
+ *  @param  name
+ *  @param  size
+ *  @param  tmp         storage for the property, if it has to be created
+ *  @return zval
  */
-static std::string convert(zend_object *object)
+static zval *property(zend_object *object, const char *name, size_t size, zval *tmp)
 {
-    // the result value from zend and the object zval
-    zval tmp, properties;
-
-    // retrieve the object properties
+#if PHP_VERSION_ID < 80000
+    // the object as zval
+    zval properties;
     ZVAL_OBJ(&properties, object);
 
-    // retrieve the message, filename, error code and line number
-#if PHP_VERSION_ID < 80000
-    auto message = zval_get_string(zend_read_property(Z_OBJCE(properties), &properties, ZEND_STRL("message"), 1, &tmp));
+    // read the property
+    return zend_read_property(object->ce, &properties, name, size, 1, tmp);
 #else
-    auto message = zval_get_string(zend_read_property(Z_OBJCE(properties), object, ZEND_STRL("message"), 1, &tmp));
+    // read the property
+    return zend_read_property(object->ce, object, name, size, 1, tmp);
 #endif
+}
+
+/**
+ *  Helper function to change the refcount of an object
+ *  @param  object
+ *  @param  add         add a reference (true) or remove one (false)
+ */
+static void reference(zend_object *object, bool add)
+{
+    // nothing to do for exceptions that were created in C++
+    if (!object) return;
+
+    // the object as zval
+    zval value;
+    ZVAL_OBJ(&value, object);
+
+    // update the refcount
+    if (add) Z_ADDREF(value); else zval_ptr_dtor(&value);
+}
+
+/**
+ *  Another protected constructor
+ *
+ *  The message and the code are not read here: most exceptions that are
+ *  thrown by PHP code only pass through the C++ frames on their way back
+ *  to PHP space, and are never inspected.
+ *
+ *  @param  object
+ */
+Throwable::Throwable(zend_object *object) : std::runtime_error(std::string()), _object(object)
+{
+    // keep the object alive for as long as the exception exists
+    reference(_object, true);
+}
+
+/**
+ *  Copy constructor
+ *
+ *  The copy does not refer to the PHP exception object, but reads its message
+ *  and code right away, because a copy may outlive the request (for example
+ *  when it is stored in a std::exception_ptr or passed to another thread).
+ *
+ *  @param  that
+ */
+Throwable::Throwable(const Throwable &that) : std::runtime_error(that.what()), _code(that.code()) {}
+
+/**
+ *  Destructor
+ */
+Throwable::~Throwable()
+{
+    // release the object
+    reference(_object, false);
+}
+
+/**
+ *  Assignment operator
+ *  @param  that
+ *  @return Throwable
+ */
+Throwable &Throwable::operator=(const Throwable &that)
+{
+    // nothing to do when assigning to ourselves
+    if (this == &that) return *this;
+
+    // just like the copy constructor, the message and code are copied
+    std::runtime_error::operator=(std::runtime_error(that.what()));
+    _code = that.code();
+
+    // the object that we wrapped is no longer needed
+    reference(_object, false);
+    _object = nullptr;
+    _message.clear();
+    _converted = false;
+
+    // allow chaining
+    return *this;
+}
+
+/**
+ *  The exception message
+ *  @return const char *
+ */
+const char *Throwable::what() const _NOEXCEPT
+{
+    // exceptions that were created in C++ have the message in the base class
+    if (!_object) return std::runtime_error::what();
+
+    // the message only has to be read once
+    if (_converted) return _message.c_str();
+
+    // remember that the message was read
+    _converted = true;
+
+    // the message property (this is normally a string already)
+    zval tmp;
+    auto *message = zval_get_string(property(_object, ZEND_STRL("message"), &tmp));
 
     // copy message to a string
-    std::string result(ZSTR_VAL(message), ZSTR_LEN(message));
+    try { _message.assign(ZSTR_VAL(message), ZSTR_LEN(message)); } catch (...) {}
 
     // clean up message string
     zend_string_release(message);
-    
+
     // done
-    return result;
+    return _message.c_str();
 }
 
 /**
- *  Another protected constructor
- *  @param  object
+ *  Returns the exception code
+ *  @return long int
  */
-Throwable::Throwable(zend_object *object) : std::runtime_error(convert(object))
+long int Throwable::code() const _NOEXCEPT
 {
-    // the result value from zend and the object zval
-    zval result, properties;
-
-    // retrieve the object properties
-    ZVAL_OBJ(&properties, object);
+    // exceptions that were created in C++ store the code themselves
+    if (!_object) return _code;
 
-    // retrieve the error code
-#if PHP_VERSION_ID < 80000
-    _code = zval_get_long(zend_read_property(Z_OBJCE(properties), &properties, ZEND_STRL("code"), 1, &result));
-#else
-    _code = zval_get_long(zend_read_property(Z_OBJCE(properties), object, ZEND_STRL("code"), 1, &result));
-#endif
+    // read the code property
+    zval tmp;
+    return zval_get_long(property(_object, ZEND_STRL("code"), &tmp));
 }
 
 /**
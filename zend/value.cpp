@@ -822,6 +822,56 @@ static Value do_exec(const zval *object, zval *method, int argc, zval *argv)
     }
 }
 
+/**
+ *  Helper function that runs a call without throwing C++ exceptions
+ *  @param  object      The object to call it on
+ *  @param  method      The function or method to call
+ *  @param  argc        Number of arguments
+ *  @param  argv        The parameters
+ *  @return Result<Value>
+ */
+static Result<Value> do_try(const zval *object, zval *method, int argc, zval *argv)
+{
+    // the return zval
+    zval retval;
+
+    // the exception that was active before the call
+    zend_object *previous = EG(exception);
+
+    // call the function
+#if PHP_VERSION_ID < 80000
+    if (call_user_function_ex(CG(function_table), (zval*) object, method, &retval, argc, argv, 1, nullptr) != SUCCESS)
+#else
+    if (call_user_function(CG(function_table), (zval*) object, method, &retval, argc, argv) != SUCCESS)
+#endif
+    {
+        // the function does not exist
+        return Error("Invalid call to "+Value(method).stringValue());
+    }
+
+    // did the call throw an exception or error? it is left in the engine
+    if (EG(exception) != nullptr && EG(exception) != previous)
+    {
+        // the return value is normally undefined, but we clean it up anyway
+        zval_ptr_dtor(&retval);
+
+        // report the pending exception
+        return Result<Value>::failed();
+    }
+
+    // leap out if nothing was returned
+    if (Z_ISUNDEF(retval)) return nullptr;
+
+    // wrap the retval in a val
+    Php::Value result(&retval);
+
+    // destruct the retval (the value holds its own reference)
+    zval_ptr_dtor(&retval);
+
+    // done
+    return result;
+}
+
 /**
  *  Call the function in PHP
  *  We have ten variants of this function, depending on the number of parameters
@@ -975,6 +1025,70 @@ Value Value::exec(const char *name, int argc, Value *argv)
     return do_exec(_val, method._val, argc, params);
 }
 
+/**
+ *  Call the function without throwing C++ exceptions
+ *  @return Result<Value>
+ */
+Result<Value> Value::tryInvoke() const
+{
+    // call with zero parameters
+    return do_try(nullptr, _val, 0, nullptr);
+}
+
+/**
+ *  Call a method without throwing C++ exceptions
+ *  @param  name        Name of the method
+ *  @return Result<Value>
+ */
+Result<Value> Value::tryCall(const char *name) const
+{
+    // wrap the name in a Php::Value to get a zval
+    Value method(name);
+
+    // call helper function
+    return do_try(_val, method._val, 0, nullptr);
+}
+
+/**
+ *  Call function with a number of parameters, without throwing C++ exceptions
+ *  @param  argc        Number of parameters
+ *  @param  argv        The parameters
+ *  @return Result<Value>
+ */
+Result<Value> Value::tryExec(int argc, Value *argv) const
+{
+    // array of zvals to execute
+    zval* params = static_cast<zval*>(alloca(argc * sizeof(zval)));
+
+    // convert all the values
+    for(int i = 0; i < argc; i++) { params[i] = *argv[i]._val; }
+
+    // call helper function
+    return do_try(nullptr, _val, argc, params);
+}
+
+/**
+ *  Call method with a number of parameters, without throwing C++ exceptions
+ *  @param  name        Name of method to call
+ *  @param  argc        Number of parameters
+ *  @param  argv        The parameters
+ *  @return Result<Value>
+ */
+Result<Value> Value::tryExec(const char *name, int argc, Value *argv) const
+{
+    // wrap the name in a Php::Value object to get a zval
+    Value method(name);
+
+    // array of zvals to execute
+    zval* params = static_cast<zval*>(alloca(argc * sizeof(zval)));
+
+    // convert all the values
+    for(int i = 0; i < argc; i++) { params[i] = *argv[i]._val; }
+
+    // call helper function
+    return do_try(_val, method._val, argc, params);
+}
+
 /**
  *  Comparison operators== for hardcoded Value
  *  @param  value
@@ -1250,6 +1364,50 @@ bool Value::derivedFrom(const char *classname, size_t size, bool allowString) co
     return instanceof_function(this_ce, ce);
 }
 
+/**
+ *  Check whether this object is an instance of a class that was looked up before
+ *  @param  classref    The class of which this should be an instance
+ *  @param  allowString Is it allowed for 'this' to be a string
+ *  @return bool
+ */
+bool Value::instanceOf(const ClassRef &classref, bool allowString) const
+{
+    // the class-entry of 'this'
+    zend_class_entry *this_ce = classEntry(allowString);
+    if (!this_ce) return false;
+
+    // the class entry of the handle (an object can not be an instance of an unknown class)
+    auto *ce = classref.entry(false);
+
+    // no such class, then we are not instanceof
+    if (!ce) return false;
+
+    // check if this is a subclass
+    return instanceof_function(this_ce, ce);
+}
+
+/**
+ *  Check whether this object is derived from a class that was looked up before
+ *  @param  classref    The class of which this should be an instance
+ *  @param  allowString Is it allowed for 'this' to be a string
+ *  @return bool
+ */
+bool Value::derivedFrom(const ClassRef &classref, bool allowString) const
+{
+    // the class-entry of 'this'
+    zend_class_entry *this_ce = classEntry(allowString);
+    if (!this_ce) return false;
+
+    // the class entry of the handle
+    auto *ce = classref.entry(false);
+
+    // unable to find the class entry, or identical class?
+    if (!ce || this_ce == ce) return false;
+
+    // check if this is a subclass
+    return instanceof_function(this_ce, ce);
+}
+
 /**
  *  Make a clone of the type
  *  @return Value
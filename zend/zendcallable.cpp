@@ -22,8 +22,9 @@ namespace Php {
  */
 Base *ZendCallable::instance(struct _zend_execute_data *execute_data)
 {
-    // find the object implementation and retrieve the base object
-    return ObjectImpl::find(getThis())->object();
+    // find the object implementation and retrieve the base object (this makes
+    // a private copy of a shared object if the method is going to modify it)
+    return ObjectImpl::find(getThis())->object(execute_data->func);
 }
 
 /**
@@ -103,6 +104,38 @@ void ZendCallable::yield(struct _zval_struct *return_value, const Php::Value &va
     RETVAL_ZVAL(value._val, 1, 0);
 }
 
+/**
+ *  Yield (return) the value of a result, or report its error
+ *
+ *  @param  return_value    The return_value to set
+ *  @param  result          The result to return to PHP
+ */
+void ZendCallable::yield(struct _zval_struct *return_value, const Result<Value> &result)
+{
+    // check the status
+    switch (result.status()) {
+    case ResultBase::Status::Success:
+        // copy the value over to the return value
+        RETVAL_ZVAL(result.value()._val, 1, 0);
+        break;
+
+    case ResultBase::Status::Pending:
+        // the exception is still in the engine, and is thrown when we return
+        RETVAL_NULL();
+        break;
+
+    case ResultBase::Status::Exception:
+        // throw a new exception in PHP space
+        zend_throw_exception(zend_ce_exception, result.message().c_str(), result.code());
+        break;
+
+    case ResultBase::Status::Error:
+        // throw a new error in PHP space
+        zend_throw_exception(zend_ce_error, result.message().c_str(), result.code());
+        break;
+    }
+}
+
 /**
  *  End namespace
  */